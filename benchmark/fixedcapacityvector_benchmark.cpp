@@ -0,0 +1,419 @@
+#include "fixedcapacityvector.h"
+#include "fixedcapacityheap.h"
+#include "fixedcapacitysort.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#ifdef SH_MATH_BENCHMARK_BOOST
+#include <boost/container/static_vector.hpp>
+#endif
+
+namespace
+{
+ //Hand rolled fixed capacity stack over std :: array, the usual alternative to fixedCapacityVector.
+ template <class Type, std :: size_t Capacity> class arrayStack
+ {
+  public:
+  typedef Type value_type;
+  arrayStack() : Size(0u) {}
+  void push_back(const Type& val) { Data[Size++] = val; }
+  template <class ... Args> void emplace_back(Args&& ... args) { Data[Size++] = Type(std :: forward<Args>(args)...); }
+  void clear() { Size = 0u; }
+  std :: size_t size() const { return Size; }
+  Type& operator [] (std :: size_t n) { return Data[n]; }
+  const Type& operator [] (std :: size_t n) const { return Data[n]; }
+  const Type* begin() const { return Data.data(); }
+  const Type* end() const { return Data.data() + Size; }
+  const Type* data() const { return Data.data(); }
+  private:
+  std :: array<Type, Capacity> Data;
+  std :: size_t Size;
+ };
+
+ template <class Type> struct valueMaker;
+
+ template <> struct valueMaker<int>
+ {
+  static int make(std :: size_t i) { return static_cast<int>(i); }
+  static std :: size_t weight(int val) { return static_cast<std :: size_t>(val); }
+ };
+
+ template <> struct valueMaker<std :: string>
+ {
+  static std :: string make(std :: size_t i) { return std :: string(24u, static_cast<char>('a' + i % 26u)); } //Longer than any small string buffer, so copies allocate.
+  static std :: size_t weight(const std :: string& val) { return val.size(); }
+ };
+
+ template <class Container> void reserve(Container&, std :: size_t)
+ {
+ }
+
+ template <class Type> void reserve(std :: vector<Type>& c, std :: size_t n)
+ {
+  c.reserve(n);
+ }
+
+ template <class Container, std :: size_t Capacity> void fill(Container& c)
+ {
+  typedef typename Container :: value_type Type;
+  reserve(c, Capacity);
+  for(std :: size_t i = 0u;i != Capacity;++i) c.push_back(valueMaker<Type> :: make(i));
+ }
+
+ template <class Container, std :: size_t Capacity> void construct(benchmark :: State& state)
+ {
+  for (auto _ : state)
+  {
+   Container c;
+   fill<Container, Capacity>(c);
+   benchmark :: DoNotOptimize(c.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Capacity);
+ }
+
+ template <class Container, std :: size_t Capacity> void pushBack(benchmark :: State& state)
+ {
+  typedef typename Container :: value_type Type;
+  const Type val = valueMaker<Type> :: make(1u);
+  Container c;
+  reserve(c, Capacity);
+  for (auto _ : state)
+  {
+   for(std :: size_t i = 0u;i != Capacity;++i) c.push_back(val);
+   benchmark :: DoNotOptimize(c.data());
+   c.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * Capacity);
+ }
+
+ template <class Container, std :: size_t Capacity> void emplaceBack(benchmark :: State& state)
+ {
+  typedef typename Container :: value_type Type;
+  const Type val = valueMaker<Type> :: make(1u);
+  Container c;
+  reserve(c, Capacity);
+  for (auto _ : state)
+  {
+   for(std :: size_t i = 0u;i != Capacity;++i) c.emplace_back(val);
+   benchmark :: DoNotOptimize(c.data());
+   c.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * Capacity);
+ }
+
+ template <class Container, std :: size_t Capacity> void copy(benchmark :: State& state)
+ {
+  Container source;
+  fill<Container, Capacity>(source);
+  for (auto _ : state)
+  {
+   Container c(source);
+   benchmark :: DoNotOptimize(c.data());
+  }
+  state.SetItemsProcessed(state.iterations() * Capacity);
+ }
+
+ template <class Container, std :: size_t Capacity> void move(benchmark :: State& state)
+ {
+  Container a;
+  fill<Container, Capacity>(a);
+  for (auto _ : state)
+  {
+   Container b(std :: move(a));
+   a = std :: move(b);
+   benchmark :: DoNotOptimize(a.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * Capacity);
+ }
+
+ template <class Container, std :: size_t Capacity> void fillClear(benchmark :: State& state)
+ {
+  Container c;
+  for (auto _ : state)
+  {
+   fill<Container, Capacity>(c);
+   c.clear();
+   benchmark :: ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * Capacity);
+ }
+
+ template <class Container, std :: size_t Capacity> void index(benchmark :: State& state)
+ {
+  typedef typename Container :: value_type Type;
+  Container c;
+  fill<Container, Capacity>(c);
+  for (auto _ : state)
+  {
+   std :: size_t sum = 0u;
+   for(std :: size_t i = 0u;i != c.size();++i) sum += valueMaker<Type> :: weight(c[i]);
+   benchmark :: DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Capacity);
+ }
+
+ template <class Container, std :: size_t Capacity> void iterate(benchmark :: State& state)
+ {
+  typedef typename Container :: value_type Type;
+  Container c;
+  fill<Container, Capacity>(c);
+  for (auto _ : state)
+  {
+   std :: size_t sum = 0u;
+   for (const Type& val : c) sum += valueMaker<Type> :: weight(val);
+   benchmark :: DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Capacity);
+ }
+
+ template <class Container, std :: size_t Capacity> void registerContainer(const std :: string& name)
+ {
+  benchmark :: RegisterBenchmark(("construct/" + name).c_str(), construct<Container, Capacity>);
+  benchmark :: RegisterBenchmark(("push_back/" + name).c_str(), pushBack<Container, Capacity>);
+  benchmark :: RegisterBenchmark(("emplace_back/" + name).c_str(), emplaceBack<Container, Capacity>);
+  benchmark :: RegisterBenchmark(("copy/" + name).c_str(), copy<Container, Capacity>);
+  benchmark :: RegisterBenchmark(("move/" + name).c_str(), move<Container, Capacity>);
+  benchmark :: RegisterBenchmark(("fill_clear/" + name).c_str(), fillClear<Container, Capacity>);
+  benchmark :: RegisterBenchmark(("index/" + name).c_str(), index<Container, Capacity>);
+  benchmark :: RegisterBenchmark(("iterate/" + name).c_str(), iterate<Container, Capacity>);
+ }
+
+ template <class Type, std :: size_t Capacity> void registerCapacity(const std :: string& typeName)
+ {
+  const std :: string suffix = "<" + typeName + ", " + std :: to_string(Capacity) + ">";
+  registerContainer<shMath :: fixedCapacityVector<Type, Capacity>, Capacity>("fixedCapacityVector" + suffix);
+  registerContainer<std :: vector<Type>, Capacity>("std::vector" + suffix);
+  registerContainer<arrayStack<Type, Capacity>, Capacity>("std::array" + suffix);
+  #ifdef SH_MATH_BENCHMARK_BOOST
+  registerContainer<boost :: container :: static_vector<Type, Capacity>, Capacity>("boost::static_vector" + suffix);
+  #endif
+ }
+
+ template <class Type> void registerType(const std :: string& typeName)
+ {
+  registerCapacity<Type, 8u>(typeName);
+  registerCapacity<Type, 64u>(typeName);
+  registerCapacity<Type, 512u>(typeName);
+ }
+
+ struct pushBackAppend
+ {
+  template <class Container> static void append(Container& c, int val) { c.push_back(val); }
+ };
+
+ struct uncheckedAppend
+ {
+  template <class Container> static void append(Container& c, int val) { c.unchecked_push_back(val); }
+ };
+
+ struct emplaceBackAppend
+ {
+  template <class Container> static void append(Container& c, int val) { c.emplace_back(val); }
+ };
+
+ //The same 64 appends whatever the capacity, so only the width of the size counter differs; an unsigned char counter may alias every element store and must not fall behind the wider ones.
+ template <class Append, class Container> void counterAppend(benchmark :: State& state)
+ {
+  Container c;
+  for (auto _ : state)
+  {
+   for(int i = 0;i != 64;++i) Append :: append(c, i);
+   benchmark :: DoNotOptimize(c.data());
+   c.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+ }
+
+ template <class Append> void registerCounter(const std :: string& method)
+ {
+  benchmark :: RegisterBenchmark(("counter/" + method + "/fixedCapacityVector<int, 64> (unsigned char size)").c_str(), counterAppend<Append, shMath :: fixedCapacityVector<int, 64u> >);
+  benchmark :: RegisterBenchmark(("counter/" + method + "/fixedCapacityVector<int, 256> (unsigned short size)").c_str(), counterAppend<Append, shMath :: fixedCapacityVector<int, 256u> >);
+ }
+
+ //Random vectors of random sizes up to Capacity, walked in turn so neither algorithm can learn one input.
+ template <class Type, std :: size_t Capacity> std :: vector<shMath :: fixedCapacityVector<Type, Capacity> > sortInputs()
+ {
+  std :: mt19937 engine(static_cast<std :: mt19937 :: result_type>(Capacity));
+  std :: uniform_int_distribution<int> value(-1000, 1000);
+  std :: uniform_int_distribution<std :: size_t> size(1u, Capacity);
+  std :: vector<shMath :: fixedCapacityVector<Type, Capacity> > inputs(1024u);
+  for (auto& input : inputs)
+  {
+   for(std :: size_t i = size(engine);i != 0u;--i) input.push_back(static_cast<Type>(value(engine)));
+  }
+  return inputs;
+ }
+
+ struct networkSort
+ {
+  template <class Vector> static void apply(Vector& a) { shMath :: sort(a); }
+ };
+
+ struct standardSort
+ {
+  template <class Vector> static void apply(Vector& a) { std :: sort(a.begin(), a.end()); }
+ };
+
+ struct networkStableSort
+ {
+  template <class Vector> static void apply(Vector& a) { shMath :: stable_sort(a); }
+ };
+
+ struct standardStableSort
+ {
+  template <class Vector> static void apply(Vector& a) { std :: stable_sort(a.begin(), a.end()); }
+ };
+
+ struct networkNthElement
+ {
+  template <class Vector> static void apply(Vector& a) { shMath :: nth_element(a, a.begin() + a.size() / 2u); }
+ };
+
+ struct standardNthElement
+ {
+  template <class Vector> static void apply(Vector& a) { std :: nth_element(a.begin(), a.begin() + a.size() / 2u, a.end()); }
+ };
+
+ template <class Algorithm, class Type, std :: size_t Capacity> void sortInput(benchmark :: State& state)
+ {
+  const std :: vector<shMath :: fixedCapacityVector<Type, Capacity> > inputs = sortInputs<Type, Capacity>();
+  std :: size_t next = 0u;
+  std :: size_t items = 0u;
+  for (auto _ : state)
+  {
+   shMath :: fixedCapacityVector<Type, Capacity> c(inputs[next]);
+   Algorithm :: apply(c);
+   benchmark :: DoNotOptimize(c.data());
+   items += c.size();
+   next = (next + 1u) % inputs.size();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(items));
+ }
+
+ template <class Type, std :: size_t Capacity> void registerSort(const std :: string& typeName)
+ {
+  const std :: string suffix = "<" + typeName + ", " + std :: to_string(Capacity) + ">";
+  benchmark :: RegisterBenchmark(("sort/shMath::sort" + suffix).c_str(), sortInput<networkSort, Type, Capacity>);
+  benchmark :: RegisterBenchmark(("sort/std::sort" + suffix).c_str(), sortInput<standardSort, Type, Capacity>);
+  benchmark :: RegisterBenchmark(("stable_sort/shMath::stable_sort" + suffix).c_str(), sortInput<networkStableSort, Type, Capacity>);
+  benchmark :: RegisterBenchmark(("stable_sort/std::stable_sort" + suffix).c_str(), sortInput<standardStableSort, Type, Capacity>);
+  benchmark :: RegisterBenchmark(("nth_element/shMath::nth_element" + suffix).c_str(), sortInput<networkNthElement, Type, Capacity>);
+  benchmark :: RegisterBenchmark(("nth_element/std::nth_element" + suffix).c_str(), sortInput<standardNthElement, Type, Capacity>);
+ }
+
+ template <class Type> void registerSortType(const std :: string& typeName)
+ {
+  registerSort<Type, 8u>(typeName);
+  registerSort<Type, 16u>(typeName);
+  registerSort<Type, 32u>(typeName);
+ }
+
+ //Random stream from which the K least values are kept, as for nearest neighbour candidates.
+ std :: vector<int> topKStream()
+ {
+  std :: mt19937 engine(4096u);
+  std :: uniform_int_distribution<int> value(0, 1 << 20);
+  std :: vector<int> stream(4096u);
+  for (auto& x : stream) x = value(engine);
+  return stream;
+ }
+
+ template <std :: size_t K> struct heapOffer
+ {
+  static void apply(const std :: vector<int>& stream, std :: vector<int>& result)
+  {
+   shMath :: fixedCapacityHeap<int, K> heap;
+   for (int x : stream) heap.offer(x);
+   heap.sorted_drain(result.begin());
+  }
+ };
+
+ template <std :: size_t K> struct heapBatchOffer
+ {
+  static void apply(const std :: vector<int>& stream, std :: vector<int>& result)
+  {
+   shMath :: fixedCapacityHeap<int, K> heap;
+   heap.offer(stream.begin(), stream.end());
+   heap.sorted_drain(result.begin());
+  }
+ };
+
+ template <std :: size_t K> struct priorityQueue
+ {
+  static void apply(const std :: vector<int>& stream, std :: vector<int>& result)
+  {
+   std :: vector<int> storage;
+   storage.reserve(K + 1u);
+   std :: priority_queue<int, std :: vector<int> > heap(std :: less<int>(), std :: move(storage));
+   for (int x : stream)
+   {
+    if (heap.size() < K)
+    {
+     heap.push(x);
+    }
+    else if (x < heap.top())
+    {
+     heap.pop();
+     heap.push(x);
+    }
+   }
+   for(std :: size_t i = heap.size();i != 0u;--i)
+   {
+    result[i - 1u] = heap.top();
+    heap.pop();
+   }
+  }
+ };
+
+ template <class Algorithm> void topK(benchmark :: State& state)
+ {
+  const std :: vector<int> stream = topKStream();
+  std :: vector<int> result(stream.size());
+  for (auto _ : state)
+  {
+   Algorithm :: apply(stream, result);
+   benchmark :: DoNotOptimize(result.data());
+   benchmark :: ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+ }
+
+ template <std :: size_t K> void registerTopK()
+ {
+  const std :: string suffix = "<" + std :: to_string(K) + ">";
+  benchmark :: RegisterBenchmark(("topK/fixedCapacityHeap::offer" + suffix).c_str(), topK<heapOffer<K> >);
+  benchmark :: RegisterBenchmark(("topK/fixedCapacityHeap::offer(range)" + suffix).c_str(), topK<heapBatchOffer<K> >);
+  benchmark :: RegisterBenchmark(("topK/std::priority_queue" + suffix).c_str(), topK<priorityQueue<K> >);
+ }
+}
+
+int main(int argc, char** argv)
+{
+ registerType<int>("int");
+ registerType<std :: string>("std::string");
+ registerCounter<pushBackAppend>("push_back");
+ registerCounter<uncheckedAppend>("unchecked_push_back");
+ registerCounter<emplaceBackAppend>("emplace_back");
+ registerSortType<int>("int");
+ registerSortType<float>("float");
+ registerTopK<16u>();
+ registerTopK<64u>();
+ registerTopK<256u>();
+ benchmark :: Initialize(&argc, argv);
+ if (benchmark :: ReportUnrecognizedArguments(argc, argv))
+ {
+  return 1;
+ }
+ benchmark :: RunSpecifiedBenchmarks();
+ benchmark :: Shutdown();
+ return 0;
+}
@@ -0,0 +1,286 @@
+#ifndef SH_MATH_CONCURRENTFIXEDCAPACITYVECTOR
+#define SH_MATH_CONCURRENTFIXEDCAPACITYVECTOR
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+#include <atomic>
+#include <thread>
+
+#if (__cplusplus < 202002)
+#else
+#include <span>
+#endif
+
+namespace shMath
+{
+ //Inline storage filled by any number of producer threads; slots are claimed with one fetch_add per batch and the vector is read once seal() returns.
+ template <class Type, std :: size_t Capacity> class concurrentFixedCapacityVector
+ {
+  static_assert(Capacity > 0u, "concurrentFixedCapacityVector needs room for at least one element.");
+  static_assert(std :: is_nothrow_destructible<Type> :: value, "concurrentFixedCapacityVector needs nothrow destructible elements.");
+  public:
+  typedef Type* pointer;
+  typedef Type& reference;
+  typedef const Type* const_pointer;
+  typedef const Type& const_reference;
+  typedef Type* iterator;
+  typedef const Type* const_iterator;
+  typedef std :: size_t size_type;
+  typedef std :: ptrdiff_t difference_type;
+  typedef Type value_type;
+  concurrentFixedCapacityVector() noexcept;
+  concurrentFixedCapacityVector(const concurrentFixedCapacityVector& a) = delete;
+  concurrentFixedCapacityVector& operator = (const concurrentFixedCapacityVector& a) = delete;
+  ~concurrentFixedCapacityVector();
+  constexpr size_type capacity() const noexcept;
+  //Producer side, callable from any number of threads until seal(); a full vector makes these return false or a short count instead of throwing.
+  bool try_push_back(const value_type& val) noexcept;
+  bool try_push_back(value_type&& val) noexcept;
+  template <class ... Args> bool try_emplace_back(Args&& ... args) noexcept;
+  size_type try_append(const value_type* first, size_type n) noexcept;
+  //Claims up to n consecutive slots starting at first; the caller constructs exactly the returned number of elements there and then calls commit with it.
+  size_type try_reserve(size_type n, pointer& first) noexcept;
+  void commit(size_type n) noexcept;
+  //Elements refused because the vector was full.
+  size_type overflow_count() const noexcept;
+  //Waits until every claimed slot is committed; afterwards the read only API below is safe and no producer may run until clear().
+  //The read only API sees the size recorded here, so before seal() the vector reads as empty.
+  void seal() noexcept;
+  pointer data() noexcept;
+  const_pointer data() const noexcept;
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  reference operator [] (size_type n) noexcept;
+  const_reference operator [] (size_type n) const noexcept;
+  reference at(size_type n);
+  const_reference at(size_type n) const;
+  #if (__cplusplus < 202002)
+  #else
+  std :: span<Type> span() noexcept;
+  std :: span<const Type> span() const noexcept;
+  #endif
+  //Not thread safe; makes the vector empty and ready for producers again.
+  void clear() noexcept;
+  private:
+  Type* element(size_type n) noexcept;
+  const Type* element(size_type n) const noexcept;
+  //Slots claimed below Capacity, committed or not.
+  size_type claimed() const noexcept;
+  //Reserved may run past Capacity; the excess counts the refused elements.
+  alignas(SH_MATH_CACHE_LINE_SIZE) std :: atomic<size_type> Reserved;
+  alignas(SH_MATH_CACHE_LINE_SIZE) std :: atomic<size_type> Committed;
+  size_type Sealed;
+  alignas(SH_MATH_CACHE_LINE_SIZE) alignas(Type) typename std :: aligned_storage <sizeof(Type), alignof(Type)> :: type Data[Capacity];
+ };
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: concurrentFixedCapacityVector <Type, Capacity> :: concurrentFixedCapacityVector() noexcept
+: Reserved(0u), Committed(0u), Sealed(0u)
+{
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: concurrentFixedCapacityVector <Type, Capacity> :: ~concurrentFixedCapacityVector()
+{
+ clear();
+}
+
+template <class Type, std :: size_t Capacity> constexpr inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type shMath :: concurrentFixedCapacityVector <Type, Capacity> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: concurrentFixedCapacityVector <Type, Capacity> :: try_push_back(const typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: value_type& val) noexcept
+{
+ return try_emplace_back(val);
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: concurrentFixedCapacityVector <Type, Capacity> :: try_push_back(typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: value_type&& val) noexcept
+{
+ return try_emplace_back(std :: move(val));
+}
+
+template <class Type, std :: size_t Capacity> template <class ... Args> inline bool shMath :: concurrentFixedCapacityVector <Type, Capacity> :: try_emplace_back(Args&& ... args) noexcept
+{
+ static_assert(std :: is_nothrow_constructible<Type, Args&& ...> :: value, "A claimed slot must always be filled, so construction must not throw.");
+ pointer address;
+ if (try_reserve(1u, address) == 0u)
+ {
+  return false;
+ }
+ new (address) Type (std :: forward<Args>(args)...);
+ commit(1u);
+ return true;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type shMath :: concurrentFixedCapacityVector <Type, Capacity> :: try_append(const typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: value_type* first, typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n) noexcept
+{
+ static_assert(std :: is_nothrow_copy_constructible<Type> :: value, "A claimed slot must always be filled, so copies must not throw.");
+ pointer result;
+ const size_type granted = try_reserve(n, result);
+ fixedCapacityVectorUninitializedCopy(first, first + granted, result);
+ commit(granted);
+ return granted;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type shMath :: concurrentFixedCapacityVector <Type, Capacity> :: try_reserve(typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n, typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: pointer& first) noexcept
+{
+ if (n == 0u)
+ {
+  first = nullptr;
+  return 0u;
+ }
+ const size_type offset = Reserved.fetch_add(n, std :: memory_order_relaxed);
+ if (offset >= Capacity)
+ {
+  first = nullptr;
+  return 0u;
+ }
+ first = reinterpret_cast<Type*>(Data + offset); //Raw storage, nothing to launder yet.
+ return (n < Capacity - offset) ? n : Capacity - offset; //A batch straddling the end keeps its head, so no slot below Capacity is left empty.
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: concurrentFixedCapacityVector <Type, Capacity> :: commit(typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n) noexcept
+{
+ if (n != 0u)
+ {
+  Committed.fetch_add(n, std :: memory_order_release);
+ }
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type shMath :: concurrentFixedCapacityVector <Type, Capacity> :: overflow_count() const noexcept
+{
+ const size_type reserved = Reserved.load(std :: memory_order_relaxed);
+ return (reserved > Capacity) ? reserved - Capacity : 0u;
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: concurrentFixedCapacityVector <Type, Capacity> :: seal() noexcept
+{
+ const size_type reserved = Reserved.load(std :: memory_order_acquire);
+ const size_type n = (reserved < Capacity) ? reserved : Capacity;
+ while (Committed.load(std :: memory_order_acquire) != n)
+ {
+  std :: this_thread :: yield();
+ }
+ Sealed = n;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: pointer shMath :: concurrentFixedCapacityVector <Type, Capacity> :: data() noexcept
+{
+ return element(0u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: const_pointer shMath :: concurrentFixedCapacityVector <Type, Capacity> :: data() const noexcept
+{
+ return element(0u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: iterator shMath :: concurrentFixedCapacityVector <Type, Capacity> :: begin() noexcept
+{
+ return data();
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: const_iterator shMath :: concurrentFixedCapacityVector <Type, Capacity> :: begin() const noexcept
+{
+ return data();
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: iterator shMath :: concurrentFixedCapacityVector <Type, Capacity> :: end() noexcept
+{
+ return data() + size();
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: const_iterator shMath :: concurrentFixedCapacityVector <Type, Capacity> :: end() const noexcept
+{
+ return data() + size();
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size() const noexcept
+{
+ return Sealed;
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: concurrentFixedCapacityVector <Type, Capacity> :: empty() const noexcept
+{
+ return (size() == 0u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: reference shMath :: concurrentFixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n) noexcept
+{
+ return *element(n);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: const_reference shMath :: concurrentFixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n) const noexcept
+{
+ return *element(n);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: reference shMath :: concurrentFixedCapacityVector <Type, Capacity> :: at(typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ if (n >= size())
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *element(n);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: const_reference shMath :: concurrentFixedCapacityVector <Type, Capacity> :: at(typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n) const
+{
+ if (n >= size())
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *element(n);
+}
+
+#if (__cplusplus < 202002)
+#else
+template <class Type, std :: size_t Capacity> inline std :: span<Type> shMath :: concurrentFixedCapacityVector <Type, Capacity> :: span() noexcept
+{
+ return std :: span<Type>(data(), size());
+}
+
+template <class Type, std :: size_t Capacity> inline std :: span<const Type> shMath :: concurrentFixedCapacityVector <Type, Capacity> :: span() const noexcept
+{
+ return std :: span<const Type>(data(), size());
+}
+#endif
+
+template <class Type, std :: size_t Capacity> inline void shMath :: concurrentFixedCapacityVector <Type, Capacity> :: clear() noexcept
+{
+ for(size_type n = claimed();n != 0u;--n) element(n - 1u)->~Type();
+ Reserved.store(0u, std :: memory_order_relaxed);
+ Committed.store(0u, std :: memory_order_relaxed);
+ Sealed = 0u;
+}
+
+template <class Type, std :: size_t Capacity> inline Type* shMath :: concurrentFixedCapacityVector <Type, Capacity> :: element(typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n) noexcept
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<Type*>(Data + n);
+ #else
+ return std :: launder(reinterpret_cast<Type*>(Data + n));
+ #endif
+}
+
+template <class Type, std :: size_t Capacity> inline const Type* shMath :: concurrentFixedCapacityVector <Type, Capacity> :: element(typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type n) const noexcept
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<const Type*>(Data + n);
+ #else
+ return std :: launder(reinterpret_cast<const Type*>(Data + n));
+ #endif
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: concurrentFixedCapacityVector <Type, Capacity> :: size_type shMath :: concurrentFixedCapacityVector <Type, Capacity> :: claimed() const noexcept
+{
+ const size_type reserved = Reserved.load(std :: memory_order_relaxed);
+ return (reserved < Capacity) ? reserved : Capacity;
+}
+#endif
+#endif
@@ -0,0 +1,722 @@
+#ifndef SH_MATH_FIXEDCAPACITYFLATMAP
+#define SH_MATH_FIXEDCAPACITYFLATMAP
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+namespace shMath
+{
+ //Branchless lower bound: the loop count depends on n only and the step compiles to a conditional move.
+ template <class Key, class Compare> std :: size_t fixedCapacityFlatLowerBound(const Key* first, std :: size_t n, const Key& key, const Compare& comp);
+
+ //One bool per element, since the map and the set hand out pointers to their elements and fixedCapacityVector<bool, Capacity> packs them into bits.
+ template <std :: size_t Capacity> class fixedCapacityFlatMapBools
+ {
+  public:
+  typedef bool value_type;
+  typedef std :: size_t size_type;
+  typedef bool* iterator;
+  typedef const bool* const_iterator;
+  fixedCapacityFlatMapBools() noexcept;
+  constexpr size_type capacity() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  bool* data() noexcept;
+  const bool* data() const noexcept;
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  bool& operator [] (size_type n) noexcept;
+  const bool& operator [] (size_type n) const noexcept;
+  bool& back() noexcept;
+  template <class ... Args> iterator emplace(const_iterator pos, Args&& ... args);
+  iterator insert(const_iterator pos, bool val);
+  void push_back(bool val);
+  iterator erase(const_iterator pos) noexcept;
+  iterator erase(const_iterator first, const_iterator last) noexcept;
+  void clear() noexcept;
+  private:
+  bool Elements[Capacity];
+  typename fixedCapacityVectorSizeType<Capacity> :: type Size;
+ };
+
+ template <class Type, std :: size_t Capacity> struct fixedCapacityFlatMapStorage
+ {
+  typedef fixedCapacityVector<Type, Capacity> type;
+ };
+
+ template <std :: size_t Capacity> struct fixedCapacityFlatMapStorage<bool, Capacity>
+ {
+  typedef fixedCapacityFlatMapBools<Capacity> type;
+ };
+
+ //Sorted keys and their values in two inline fixedCapacityVector arrays, so a lookup only walks the keys.
+ template <class Key, class Value, std :: size_t Capacity, class Compare = std :: less<Key> > class fixedCapacityFlatMap : private Compare
+ {
+  public:
+  typedef Key key_type;
+  typedef Value mapped_type;
+  typedef Compare key_compare;
+  typedef std :: size_t size_type;
+  typedef typename fixedCapacityFlatMapStorage<Key, Capacity> :: type key_container_type;
+  typedef typename fixedCapacityFlatMapStorage<Value, Capacity> :: type mapped_container_type;
+  fixedCapacityFlatMap() noexcept(std :: is_nothrow_default_constructible<Compare>{});
+  explicit fixedCapacityFlatMap(const key_compare& comp) noexcept(std :: is_nothrow_copy_constructible<Compare>{});
+  //Bulk construction from unsorted pairs sorts once and keeps the first of several equivalent keys, as with repeated insert; input that fills the map is deduplicated early, so only distinct keys count against Capacity. Moves from the pairs when the iterator yields rvalues.
+  template <class InputIterator, class = typename std :: enable_if<!std :: is_integral<InputIterator> :: value> :: type> fixedCapacityFlatMap(InputIterator first, InputIterator last, const key_compare& comp = key_compare());
+  fixedCapacityFlatMap(std :: initializer_list<std :: pair<Key, Value> > list, const key_compare& comp = key_compare());
+  key_compare key_comp() const;
+  constexpr size_type capacity() const noexcept;
+  constexpr size_type max_size() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  const key_container_type& keys() const noexcept;
+  const mapped_container_type& values() const noexcept;
+  const key_type& key_at(size_type n) const noexcept;
+  mapped_type& value_at(size_type n) noexcept;
+  const mapped_type& value_at(size_type n) const noexcept;
+  //Lookups return the position of key, or size() when it is absent.
+  size_type index_of(const key_type& key) const;
+  mapped_type* find(const key_type& key);
+  const mapped_type* find(const key_type& key) const;
+  bool contains(const key_type& key) const;
+  size_type count(const key_type& key) const;
+  mapped_type& at(const key_type& key);
+  const mapped_type& at(const key_type& key) const;
+  mapped_type& operator [] (const key_type& key);
+  template <class ... Args> std :: pair<mapped_type*, bool> try_emplace(const key_type& key, Args&& ... args);
+  std :: pair<mapped_type*, bool> insert(const std :: pair<Key, Value>& val);
+  std :: pair<mapped_type*, bool> insert(std :: pair<Key, Value>&& val);
+  template <class Mapped> std :: pair<mapped_type*, bool> insert_or_assign(const key_type& key, Mapped&& val);
+  size_type erase(const key_type& key);
+  void erase_at(size_type n);
+  void clear() noexcept(std :: is_nothrow_destructible<Key>{} && std :: is_nothrow_destructible<Value>{});
+  private:
+  size_type lowerBound(const key_type& key) const;
+  bool matches(size_type n, const key_type& key) const;
+  template <class InputIterator> void assignUnsorted(InputIterator first, InputIterator last);
+  void sortUnique();
+  key_container_type Keys;
+  mapped_container_type Values;
+ };
+
+ //Sorted keys in one inline fixedCapacityVector.
+ template <class Key, std :: size_t Capacity, class Compare = std :: less<Key> > class fixedCapacityFlatSet : private Compare
+ {
+  public:
+  typedef Key key_type;
+  typedef Key value_type;
+  typedef Compare key_compare;
+  typedef Compare value_compare;
+  typedef std :: size_t size_type;
+  typedef const Key* iterator;
+  typedef const Key* const_iterator;
+  typedef typename fixedCapacityFlatMapStorage<Key, Capacity> :: type container_type;
+  fixedCapacityFlatSet() noexcept(std :: is_nothrow_default_constructible<Compare>{});
+  explicit fixedCapacityFlatSet(const key_compare& comp) noexcept(std :: is_nothrow_copy_constructible<Compare>{});
+  //Bulk construction from unsorted keys sorts once and drops duplicates; input that fills the set is deduplicated early, so only distinct keys count against Capacity.
+  template <class InputIterator, class = typename std :: enable_if<!std :: is_integral<InputIterator> :: value> :: type> fixedCapacityFlatSet(InputIterator first, InputIterator last, const key_compare& comp = key_compare());
+  fixedCapacityFlatSet(std :: initializer_list<Key> list, const key_compare& comp = key_compare());
+  key_compare key_comp() const;
+  constexpr size_type capacity() const noexcept;
+  constexpr size_type max_size() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  const container_type& keys() const noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator find(const key_type& key) const;
+  const_iterator lower_bound(const key_type& key) const;
+  const_iterator upper_bound(const key_type& key) const;
+  bool contains(const key_type& key) const;
+  size_type count(const key_type& key) const;
+  std :: pair<const_iterator, bool> insert(const key_type& key);
+  std :: pair<const_iterator, bool> insert(key_type&& key);
+  template <class ... Args> std :: pair<const_iterator, bool> emplace(Args&& ... args);
+  size_type erase(const key_type& key);
+  const_iterator erase(const_iterator pos);
+  void clear() noexcept(std :: is_nothrow_destructible<Key>{});
+  private:
+  size_type lowerBound(const key_type& key) const;
+  template <class KeyType> std :: pair<const_iterator, bool> insertKey(KeyType&& key);
+  void sortUnique();
+  container_type Keys;
+ };
+}
+
+template <class Key, class Compare> inline std :: size_t shMath :: fixedCapacityFlatLowerBound(const Key* first, std :: size_t n, const Key& key, const Compare& comp)
+{
+ if (n == 0u)
+ {
+  return 0u;
+ }
+ const Key* base = first;
+ while (n > 1u)
+ {
+  const std :: size_t half = n / 2u;
+  base = comp(base[half], key) ? base + half : base;
+  n -= half;
+ }
+ return static_cast<std :: size_t>(base - first) + static_cast<std :: size_t>(comp(*base, key));
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityFlatMapBools <Capacity> :: fixedCapacityFlatMapBools() noexcept
+: Elements(), Size(0u)
+{
+}
+
+template <std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: size_type shMath :: fixedCapacityFlatMapBools <Capacity> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: size_type shMath :: fixedCapacityFlatMapBools <Capacity> :: size() const noexcept
+{
+ return Size;
+}
+
+template <std :: size_t Capacity> inline bool shMath :: fixedCapacityFlatMapBools <Capacity> :: empty() const noexcept
+{
+ return (Size == 0u);
+}
+
+template <std :: size_t Capacity> inline bool* shMath :: fixedCapacityFlatMapBools <Capacity> :: data() noexcept
+{
+ return Elements;
+}
+
+template <std :: size_t Capacity> inline const bool* shMath :: fixedCapacityFlatMapBools <Capacity> :: data() const noexcept
+{
+ return Elements;
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: iterator shMath :: fixedCapacityFlatMapBools <Capacity> :: begin() noexcept
+{
+ return Elements;
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: const_iterator shMath :: fixedCapacityFlatMapBools <Capacity> :: begin() const noexcept
+{
+ return Elements;
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: iterator shMath :: fixedCapacityFlatMapBools <Capacity> :: end() noexcept
+{
+ return Elements + size();
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: const_iterator shMath :: fixedCapacityFlatMapBools <Capacity> :: end() const noexcept
+{
+ return Elements + size();
+}
+
+template <std :: size_t Capacity> inline bool& shMath :: fixedCapacityFlatMapBools <Capacity> :: operator [] (typename shMath :: fixedCapacityFlatMapBools <Capacity> :: size_type n) noexcept
+{
+ return Elements[n];
+}
+
+template <std :: size_t Capacity> inline const bool& shMath :: fixedCapacityFlatMapBools <Capacity> :: operator [] (typename shMath :: fixedCapacityFlatMapBools <Capacity> :: size_type n) const noexcept
+{
+ return Elements[n];
+}
+
+template <std :: size_t Capacity> inline bool& shMath :: fixedCapacityFlatMapBools <Capacity> :: back() noexcept
+{
+ return Elements[size() - 1u];
+}
+
+template <std :: size_t Capacity> template <class ... Args> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: iterator shMath :: fixedCapacityFlatMapBools <Capacity> :: emplace(typename shMath :: fixedCapacityFlatMapBools <Capacity> :: const_iterator pos, Args&& ... args)
+{
+ const size_type n = Size;
+ if (n == Capacity)
+ {
+  fixedCapacityVectorOverflow<bool, Capacity>();
+ }
+ const bool val = bool(std :: forward<Args>(args)...);
+ bool* const result = Elements + (pos - Elements);
+ std :: copy_backward(result, Elements + n, Elements + n + 1u);
+ *result = val;
+ Size = n + 1u;
+ return result;
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: iterator shMath :: fixedCapacityFlatMapBools <Capacity> :: insert(typename shMath :: fixedCapacityFlatMapBools <Capacity> :: const_iterator pos, bool val)
+{
+ return emplace(pos, val);
+}
+
+template <std :: size_t Capacity> inline void shMath :: fixedCapacityFlatMapBools <Capacity> :: push_back(bool val)
+{
+ emplace(end(), val);
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: iterator shMath :: fixedCapacityFlatMapBools <Capacity> :: erase(typename shMath :: fixedCapacityFlatMapBools <Capacity> :: const_iterator pos) noexcept
+{
+ const size_type n = Size;
+ bool* const result = Elements + (pos - Elements);
+ std :: copy(result + 1, Elements + n, result);
+ Size = n - 1u;
+ return result;
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityFlatMapBools <Capacity> :: iterator shMath :: fixedCapacityFlatMapBools <Capacity> :: erase(typename shMath :: fixedCapacityFlatMapBools <Capacity> :: const_iterator first, typename shMath :: fixedCapacityFlatMapBools <Capacity> :: const_iterator last) noexcept
+{
+ bool* const result = Elements + (first - Elements);
+ Size = static_cast<size_type>(std :: copy(last, const_iterator(Elements + Size), result) - Elements);
+ return result;
+}
+
+template <std :: size_t Capacity> inline void shMath :: fixedCapacityFlatMapBools <Capacity> :: clear() noexcept
+{
+ Size = 0u;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: fixedCapacityFlatMap() noexcept(std :: is_nothrow_default_constructible<Compare>{})
+: Compare()
+{
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: fixedCapacityFlatMap(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_compare& comp) noexcept(std :: is_nothrow_copy_constructible<Compare>{})
+: Compare(comp)
+{
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> template <class InputIterator, class> inline shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: fixedCapacityFlatMap(InputIterator first, InputIterator last, const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_compare& comp)
+: Compare(comp)
+{
+ assignUnsorted(first, last);
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: fixedCapacityFlatMap(std :: initializer_list<std :: pair<Key, Value> > list, const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_compare& comp)
+: Compare(comp)
+{
+ assignUnsorted(list.begin(), list.end());
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_compare shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_comp() const
+{
+ return static_cast<const Compare&>(*this);
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> constexpr inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> constexpr inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: max_size() const noexcept
+{
+ return Capacity;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size() const noexcept
+{
+ return Keys.size();
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: empty() const noexcept
+{
+ return Keys.empty();
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_container_type& shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: keys() const noexcept
+{
+ return Keys;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_container_type& shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: values() const noexcept
+{
+ return Values;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_at(typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type n) const noexcept
+{
+ return Keys[n];
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type& shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: value_at(typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type n) noexcept
+{
+ return Values[n];
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type& shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: value_at(typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type n) const noexcept
+{
+ return Values[n];
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: index_of(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key) const
+{
+ const size_type n = lowerBound(key);
+ return matches(n, key) ? n : Keys.size();
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type* shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: find(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key)
+{
+ const size_type n = lowerBound(key);
+ return matches(n, key) ? Values.data() + n : nullptr;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type* shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: find(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key) const
+{
+ const size_type n = lowerBound(key);
+ return matches(n, key) ? Values.data() + n : nullptr;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: contains(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key) const
+{
+ return matches(lowerBound(key), key);
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: count(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key) const
+{
+ return contains(key) ? 1u : 0u;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type& shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: at(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key)
+{
+ mapped_type* const result = find(key);
+ if (result == nullptr)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *result;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type& shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: at(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key) const
+{
+ const mapped_type* const result = find(key);
+ if (result == nullptr)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *result;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type& shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: operator [] (const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key)
+{
+ return *try_emplace(key).first;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> template <class ... Args> std :: pair<typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type*, bool> shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: try_emplace(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key, Args&& ... args)
+{
+ const size_type n = lowerBound(key);
+ if (matches(n, key))
+ {
+  return std :: pair<mapped_type*, bool>(Values.data() + n, false);
+ }
+ Values.emplace(Values.begin() + n, std :: forward<Args>(args)...);
+ SH_MATH_TRY
+ {
+  Keys.insert(Keys.begin() + n, key);
+ }
+ SH_MATH_CATCH_ALL
+ {
+  Values.erase(Values.begin() + n);
+  SH_MATH_RETHROW;
+ }
+ return std :: pair<mapped_type*, bool>(Values.data() + n, true);
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline std :: pair<typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type*, bool> shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: insert(const std :: pair<Key, Value>& val)
+{
+ return try_emplace(val.first, val.second);
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline std :: pair<typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type*, bool> shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: insert(std :: pair<Key, Value>&& val)
+{
+ return try_emplace(val.first, std :: move(val.second));
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> template <class Mapped> inline std :: pair<typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: mapped_type*, bool> shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: insert_or_assign(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key, Mapped&& val)
+{
+ mapped_type* const result = find(key);
+ if (result != nullptr)
+ {
+  *result = std :: forward<Mapped>(val);
+  return std :: pair<mapped_type*, bool>(result, false);
+ }
+ return try_emplace(key, std :: forward<Mapped>(val));
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: erase(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key)
+{
+ const size_type n = lowerBound(key);
+ if (!matches(n, key))
+ {
+  return 0u;
+ }
+ erase_at(n);
+ return 1u;
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: erase_at(typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type n)
+{
+ Keys.erase(Keys.begin() + n);
+ Values.erase(Values.begin() + n);
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: clear() noexcept(std :: is_nothrow_destructible<Key>{} && std :: is_nothrow_destructible<Value>{})
+{
+ Keys.clear();
+ Values.clear();
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: lowerBound(const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key) const
+{
+ return fixedCapacityFlatLowerBound(Keys.data(), Keys.size(), key, static_cast<const Compare&>(*this));
+}
+
+template <class Key, class Value, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: matches(typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: size_type n, const typename shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: key_type& key) const
+{
+ return (n != Keys.size()) && !static_cast<const Compare&>(*this)(key, Keys[n]);
+}
+
+//Appends in input order and sorts once at the end. Only a full map is sorted early, after which keys it already holds are found by binary search and skipped.
+template <class Key, class Value, std :: size_t Capacity, class Compare> template <class InputIterator> void shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: assignUnsorted(InputIterator first, InputIterator last)
+{
+ typedef typename std :: iterator_traits<InputIterator> :: reference reference;
+ const Compare& comp = *this;
+ Keys.clear();
+ Values.clear();
+ size_type sorted = 0u; //Keys before this are sorted and distinct.
+ for(;first != last;++first)
+ {
+  reference val = *first;
+  if ((Keys.size() == Capacity) && (sorted != Capacity))
+  {
+   sortUnique();
+   sorted = Keys.size();
+  }
+  const size_type n = fixedCapacityFlatLowerBound<Key>(Keys.data(), sorted, val.first, comp);
+  if ((n != sorted) && !comp(val.first, Keys[n]))
+  {
+   continue;
+  }
+  Values.push_back(std :: forward<reference>(val).second);
+  SH_MATH_TRY
+  {
+   Keys.push_back(std :: forward<reference>(val).first);
+  }
+  SH_MATH_CATCH_ALL
+  {
+   Values.erase(Values.end() - 1);
+   SH_MATH_RETHROW;
+  }
+ }
+ sortUnique();
+}
+
+//Sorts a permutation with the position as tie break, so the earliest of equivalent keys comes first and survives, then swaps each survivor into place.
+template <class Key, class Value, std :: size_t Capacity, class Compare> void shMath :: fixedCapacityFlatMap <Key, Value, Capacity, Compare> :: sortUnique()
+{
+ const Compare& comp = *this;
+ const size_type count = (Keys.size() < Capacity) ? Keys.size() : Capacity; //Never clamps, but lets GCC drop the std :: sort branches for ranges past Capacity instead of reporting them under -Warray-bounds.
+ fixedCapacityVector<size_type, Capacity> order, at, where;
+ for(size_type n = 0u;n != count;++n)
+ {
+  order.push_back(n);
+  at.push_back(n);
+  where.push_back(n);
+ }
+ std :: sort(order.data(), order.data() + count, [this, &comp](size_type a, size_type b)
+ {
+  return comp(Keys[a], Keys[b]) || (!comp(Keys[b], Keys[a]) && (a < b));
+ });
+ size_type kept = 0u;
+ for(size_type n = 0u;n != count;++n)
+ {
+  if ((kept == 0u) || comp(Keys[order[kept - 1u]], Keys[order[n]]))
+  {
+   order[kept++] = order[n];
+  }
+ }
+ using std :: swap;
+ for(size_type n = 0u;n != kept;++n)
+ {
+  const size_type from = where[order[n]];
+  if (from != n)
+  {
+   swap(Keys[n], Keys[from]);
+   swap(Values[n], Values[from]);
+   at[from] = at[n];
+   where[at[from]] = from;
+   at[n] = order[n];
+   where[order[n]] = n;
+  }
+ }
+ Keys.erase(Keys.begin() + kept, Keys.end());
+ Values.erase(Values.begin() + kept, Values.end());
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: fixedCapacityFlatSet() noexcept(std :: is_nothrow_default_constructible<Compare>{})
+: Compare()
+{
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: fixedCapacityFlatSet(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_compare& comp) noexcept(std :: is_nothrow_copy_constructible<Compare>{})
+: Compare(comp)
+{
+}
+
+template <class Key, std :: size_t Capacity, class Compare> template <class InputIterator, class> shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: fixedCapacityFlatSet(InputIterator first, InputIterator last, const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_compare& comp)
+: Compare(comp)
+{
+ size_type sorted = 0u; //Keys before this are sorted and distinct.
+ for(;first != last;++first)
+ {
+  if ((Keys.size() == Capacity) && (sorted != Capacity))
+  {
+   //Only duplicates can make room, so drop them before the push below overflows; keys already held are skipped from then on.
+   sortUnique();
+   sorted = Keys.size();
+  }
+  const size_type n = fixedCapacityFlatLowerBound<Key>(Keys.data(), sorted, *first, static_cast<const Compare&>(*this));
+  if ((n != sorted) && !static_cast<const Compare&>(*this)(*first, Keys[n]))
+  {
+   continue;
+  }
+  Keys.push_back(*first);
+ }
+ sortUnique();
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: fixedCapacityFlatSet(std :: initializer_list<Key> list, const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_compare& comp)
+: fixedCapacityFlatSet(list.begin(), list.end(), comp)
+{
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_compare shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_comp() const
+{
+ return static_cast<const Compare&>(*this);
+}
+
+template <class Key, std :: size_t Capacity, class Compare> constexpr inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <class Key, std :: size_t Capacity, class Compare> constexpr inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: max_size() const noexcept
+{
+ return Capacity;
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: size() const noexcept
+{
+ return Keys.size();
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: empty() const noexcept
+{
+ return Keys.empty();
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: container_type& shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: keys() const noexcept
+{
+ return Keys;
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: begin() const noexcept
+{
+ return Keys.data();
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: end() const noexcept
+{
+ return Keys.data() + Keys.size();
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: find(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type& key) const
+{
+ const_iterator const result = lower_bound(key);
+ return ((result != end()) && !static_cast<const Compare&>(*this)(key, *result)) ? result : end();
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: lower_bound(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type& key) const
+{
+ return begin() + lowerBound(key);
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: upper_bound(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type& key) const
+{
+ const_iterator const result = lower_bound(key);
+ return ((result != end()) && !static_cast<const Compare&>(*this)(key, *result)) ? result + 1 : result;
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: contains(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type& key) const
+{
+ return (find(key) != end());
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: count(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type& key) const
+{
+ return contains(key) ? 1u : 0u;
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline std :: pair<typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator, bool> shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: insert(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type& key)
+{
+ return insertKey(key);
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline std :: pair<typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator, bool> shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: insert(typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type&& key)
+{
+ return insertKey(std :: move(key));
+}
+
+template <class Key, std :: size_t Capacity, class Compare> template <class ... Args> inline std :: pair<typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator, bool> shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: emplace(Args&& ... args)
+{
+ return insertKey(Key(std :: forward<Args>(args)...));
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: erase(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type& key)
+{
+ const_iterator const pos = find(key);
+ if (pos == end())
+ {
+  return 0u;
+ }
+ erase(pos);
+ return 1u;
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: erase(typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator pos)
+{
+ return Keys.erase(pos);
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: clear() noexcept(std :: is_nothrow_destructible<Key>{})
+{
+ Keys.clear();
+}
+
+template <class Key, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: size_type shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: lowerBound(const typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: key_type& key) const
+{
+ return fixedCapacityFlatLowerBound(Keys.data(), Keys.size(), key, static_cast<const Compare&>(*this));
+}
+
+template <class Key, std :: size_t Capacity, class Compare> template <class KeyType> std :: pair<typename shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: const_iterator, bool> shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: insertKey(KeyType&& key)
+{
+ const size_type n = lowerBound(key);
+ if ((n != Keys.size()) && !static_cast<const Compare&>(*this)(key, Keys[n]))
+ {
+  return std :: pair<const_iterator, bool>(begin() + n, false);
+ }
+ Keys.insert(Keys.begin() + n, std :: forward<KeyType>(key));
+ return std :: pair<const_iterator, bool>(begin() + n, true);
+}
+
+template <class Key, std :: size_t Capacity, class Compare> void shMath :: fixedCapacityFlatSet <Key, Capacity, Compare> :: sortUnique()
+{
+ const Compare& order = *this;
+ std :: sort(Keys.begin(), Keys.end(), order);
+ Keys.erase(std :: unique(Keys.begin(), Keys.end(), [&order](const Key& a, const Key& b)
+ {
+  return !order(a, b);
+ }), Keys.end());
+}
+#endif
+#endif
@@ -0,0 +1,254 @@
+#ifndef SH_MATH_FIXEDCAPACITYHEAP
+#define SH_MATH_FIXEDCAPACITYHEAP
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+#include <functional>
+
+namespace shMath
+{
+ //Binary heap in an inline fixedCapacityVector, ordered like std :: priority_queue: top() is the greatest element under Compare.
+ //offer() keeps the Capacity least elements under Compare seen so far; once full, top() is the worst one kept, so a worse candidate is rejected after a single comparison.
+ template <class Type, std :: size_t Capacity, class Compare = std :: less<Type> > class fixedCapacityHeap : private Compare
+ {
+  static_assert(Capacity > 0u, "fixedCapacityHeap needs room for at least one element.");
+  public:
+  typedef Type value_type;
+  typedef const Type& const_reference;
+  typedef Compare value_compare;
+  typedef std :: size_t size_type;
+  typedef fixedCapacityVector<Type, Capacity> container_type;
+  fixedCapacityHeap() noexcept(std :: is_nothrow_default_constructible<Compare>{});
+  explicit fixedCapacityHeap(const value_compare& comp) noexcept(std :: is_nothrow_copy_constructible<Compare>{});
+  value_compare value_comp() const;
+  constexpr size_type capacity() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  bool full() const noexcept;
+  //The elements in heap order.
+  const container_type& container() const noexcept;
+  const_reference top() const noexcept;
+  void push(const value_type& val);
+  void push(value_type&& val);
+  template <class ... Args> void emplace(Args&& ... args);
+  void pop();
+  //Returns whether val was kept; when full it replaces top() only if it compares less.
+  bool offer(const value_type& val);
+  bool offer(value_type&& val);
+  //Fills the free room without capacity checks, then only compares each remaining element with top(); returns how many elements were kept at the time they were offered.
+  template <class InputIterator> size_type offer(InputIterator first, InputIterator last);
+  //Empties the heap, handing out its elements from the least to the greatest under Compare, that is best first for offer(), without allocating.
+  container_type sorted_drain();
+  template <class OutputIterator> OutputIterator sorted_drain(OutputIterator result);
+  void clear() noexcept(std :: is_nothrow_destructible<Type>{});
+  void swap(fixedCapacityHeap& a);
+  private:
+  const Compare& comp() const noexcept;
+  template <class Value> void replaceTop(Value&& val);
+  container_type Elements;
+ };
+
+ //top() is the greatest element; offer() keeps the Capacity least ones, such as the nearest neighbour candidates.
+ template <class Type, std :: size_t Capacity> using fixedCapacityMaxHeap = fixedCapacityHeap<Type, Capacity, std :: less<Type> >;
+ //top() is the least element; offer() keeps the Capacity greatest ones, such as the slowest latencies for a percentile.
+ template <class Type, std :: size_t Capacity> using fixedCapacityMinHeap = fixedCapacityHeap<Type, Capacity, std :: greater<Type> >;
+
+ template <class Type, std :: size_t Capacity, class Compare> void swap(fixedCapacityHeap<Type, Capacity, Compare>& a, fixedCapacityHeap<Type, Capacity, Compare>& b);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: fixedCapacityHeap() noexcept(std :: is_nothrow_default_constructible<Compare>{})
+: Compare()
+{
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: fixedCapacityHeap(const typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: value_compare& comp) noexcept(std :: is_nothrow_copy_constructible<Compare>{})
+: Compare(comp)
+{
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: value_compare shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: value_comp() const
+{
+ return comp();
+}
+
+template <class Type, std :: size_t Capacity, class Compare> constexpr inline typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: size_type shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: size_type shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: size() const noexcept
+{
+ return Elements.size();
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: empty() const noexcept
+{
+ return Elements.empty();
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: full() const noexcept
+{
+ return (Elements.size() == Capacity);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline const typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: container_type& shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: container() const noexcept
+{
+ return Elements;
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: const_reference shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: top() const noexcept
+{
+ return Elements.front();
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: push(const typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: value_type& val)
+{
+ Elements.push_back(val);
+ std :: push_heap(Elements.begin(), Elements.end(), comp());
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: push(typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: value_type&& val)
+{
+ Elements.push_back(std :: move(val));
+ std :: push_heap(Elements.begin(), Elements.end(), comp());
+}
+
+template <class Type, std :: size_t Capacity, class Compare> template <class ... Args> inline void shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: emplace(Args&& ... args)
+{
+ Elements.emplace_back(std :: forward<Args>(args)...);
+ std :: push_heap(Elements.begin(), Elements.end(), comp());
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: pop()
+{
+ if (Capacity != 1u) //One element is already in order; skipping the call also keeps -Warray-bounds from following the children it can never have.
+ {
+  std :: pop_heap(Elements.begin(), Elements.end(), comp());
+ }
+ Elements.pop_back();
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: offer(const typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: value_type& val)
+{
+ if (Elements.size() == Capacity)
+ {
+  if (!comp()(val, Elements.front()))
+  {
+   return false;
+  }
+  replaceTop(val);
+  return true;
+ }
+ push(val);
+ return true;
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline bool shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: offer(typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: value_type&& val)
+{
+ if (Elements.size() == Capacity)
+ {
+  if (!comp()(val, Elements.front()))
+  {
+   return false;
+  }
+  replaceTop(std :: move(val));
+  return true;
+ }
+ push(std :: move(val));
+ return true;
+}
+
+template <class Type, std :: size_t Capacity, class Compare> template <class InputIterator> typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: size_type shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: offer(InputIterator first, InputIterator last)
+{
+ const size_type heapSize = Elements.size();
+ for(;(first != last) && (Elements.size() != Capacity);++first)
+ {
+  Elements.unchecked_push_back(*first);
+  std :: push_heap(Elements.begin(), Elements.end(), comp()); //Measured faster than one make_heap for the later replacements.
+ }
+ size_type accepted = Elements.size() - heapSize;
+ for(;first != last;++first)
+ {
+  if (comp()(*first, Elements.front()))
+  {
+   replaceTop(*first);
+   ++accepted;
+  }
+ }
+ return accepted;
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline typename shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: container_type shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: sorted_drain()
+{
+ if (Capacity != 1u)
+ {
+  std :: sort_heap(Elements.begin(), Elements.end(), comp());
+ }
+ container_type result(std :: move(Elements));
+ Elements.clear();
+ return result;
+}
+
+template <class Type, std :: size_t Capacity, class Compare> template <class OutputIterator> inline OutputIterator shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: sorted_drain(OutputIterator result)
+{
+ if (Capacity != 1u)
+ {
+  std :: sort_heap(Elements.begin(), Elements.end(), comp());
+ }
+ result = std :: move(Elements.begin(), Elements.end(), result);
+ Elements.clear();
+ return result;
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: clear() noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ Elements.clear();
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: swap(shMath :: fixedCapacityHeap <Type, Capacity, Compare>& a)
+{
+ using std :: swap;
+ swap(static_cast<Compare&>(*this), static_cast<Compare&>(a));
+ Elements.swap(a.Elements);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline const Compare& shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: comp() const noexcept
+{
+ return *this;
+}
+
+template <class Type, std :: size_t Capacity, class Compare> template <class Value> inline void shMath :: fixedCapacityHeap <Type, Capacity, Compare> :: replaceTop(Value&& val)
+{
+ //Walks a hole down from the root instead of a pop_heap and push_heap pair, so each level costs two comparisons and one move.
+ Type* const elements = Elements.data();
+ if (Capacity == 1u)
+ {
+  elements[0] = std :: forward<Value>(val);
+  return;
+ }
+ const size_type n = Elements.size();
+ size_type hole = 0u;
+ for(size_type child = 1u;child < n;child = 2u * hole + 1u)
+ {
+  if ((child + 1u < n) && comp()(elements[child], elements[child + 1u]))
+  {
+   ++child;
+  }
+  if (!comp()(val, elements[child]))
+  {
+   break;
+  }
+  elements[hole] = std :: move(elements[child]);
+  hole = child;
+ }
+ elements[hole] = std :: forward<Value>(val);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: swap(shMath :: fixedCapacityHeap<Type, Capacity, Compare>& a, shMath :: fixedCapacityHeap<Type, Capacity, Compare>& b)
+{
+ a.swap(b);
+}
+#endif
+#endif
@@ -0,0 +1,230 @@
+#ifndef SH_MATH_FIXEDCAPACITYRING
+#define SH_MATH_FIXEDCAPACITYRING
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+#include <atomic>
+
+#if (__cplusplus < 202002)
+#else
+#include <span>
+#endif
+
+namespace shMath
+{
+ //Wait-free ring for exactly one producer thread and one consumer thread; all storage is inline.
+ template <class Type, std :: size_t Capacity> class fixedCapacityRing
+ {
+  static_assert(Capacity > 0u, "fixedCapacityRing needs room for at least one element.");
+  public:
+  typedef Type value_type;
+  typedef std :: size_t size_type;
+  fixedCapacityRing() noexcept;
+  fixedCapacityRing(const fixedCapacityRing& a) = delete;
+  fixedCapacityRing& operator = (const fixedCapacityRing& a) = delete;
+  ~fixedCapacityRing() noexcept(std :: is_nothrow_destructible<Type>{});
+  constexpr size_type capacity() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  //Producer side.
+  bool try_push(const value_type& val) noexcept(std :: is_nothrow_copy_constructible<Type>{});
+  bool try_push(value_type&& val) noexcept(std :: is_nothrow_move_constructible<Type>{});
+  template <class ... Args> bool try_emplace(Args&& ... args) noexcept(std :: is_nothrow_constructible<Type, Args&& ...>{});
+  size_type try_push_n(const value_type* first, size_type n);
+  //Consumer side.
+  bool try_pop(value_type& val) noexcept(std :: is_nothrow_move_assignable<Type>{} && std :: is_nothrow_destructible<Type>{});
+  size_type try_pop_n(value_type* result, size_type n) noexcept(std :: is_nothrow_move_assignable<Type>{} && std :: is_nothrow_destructible<Type>{});
+  #if (__cplusplus < 202002)
+  #else
+  size_type try_push_n(std :: span<const value_type> values);
+  size_type try_pop_n(std :: span<value_type> values) noexcept(std :: is_nothrow_move_assignable<Type>{} && std :: is_nothrow_destructible<Type>{});
+  #endif
+  private:
+  typedef std :: integral_constant<bool, ((Capacity & (Capacity - 1u)) == 0u)> powerOfTwo;
+  Type* element(size_type index) noexcept;
+  void destroy(size_type index, size_type n) noexcept(std :: is_nothrow_destructible<Type>{});
+  static size_type advance(size_type index, size_type n, std :: integral_constant<bool, false>) noexcept;
+  static size_type advance(size_type index, size_type n, std :: integral_constant<bool, true>) noexcept;
+  static size_type slot(size_type index, std :: integral_constant<bool, false>) noexcept;
+  static size_type slot(size_type index, std :: integral_constant<bool, true>) noexcept;
+  static size_type distance(size_type tail, size_type head, std :: integral_constant<bool, false>) noexcept;
+  static size_type distance(size_type tail, size_type head, std :: integral_constant<bool, true>) noexcept;
+  //Indices run freely for power-of-two capacities and modulo 2 * Capacity otherwise, so a full ring is told apart from an empty one without a spare slot.
+  alignas(SH_MATH_CACHE_LINE_SIZE) std :: atomic<size_type> Head;
+  size_type CachedTail;
+  alignas(SH_MATH_CACHE_LINE_SIZE) std :: atomic<size_type> Tail;
+  size_type CachedHead;
+  alignas(SH_MATH_CACHE_LINE_SIZE) alignas(Type) typename std :: aligned_storage <sizeof(Type), alignof(Type)> :: type Data[Capacity];
+ };
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityRing <Type, Capacity> :: fixedCapacityRing() noexcept
+: Head(0u), CachedTail(0u), Tail(0u), CachedHead(0u)
+{
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityRing <Type, Capacity> :: ~fixedCapacityRing() noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ const size_type head = Head.load(std :: memory_order_relaxed);
+ destroy(head, distance(Tail.load(std :: memory_order_acquire), head, powerOfTwo{}));
+}
+
+template <class Type, std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: size() const noexcept
+{
+ const size_type head = Head.load(std :: memory_order_acquire);
+ return distance(Tail.load(std :: memory_order_acquire), head, powerOfTwo{});
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityRing <Type, Capacity> :: empty() const noexcept
+{
+ return (size() == 0u);
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityRing <Type, Capacity> :: try_push(const typename shMath :: fixedCapacityRing <Type, Capacity> :: value_type& val) noexcept(std :: is_nothrow_copy_constructible<Type>{})
+{
+ return try_emplace(val);
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityRing <Type, Capacity> :: try_push(typename shMath :: fixedCapacityRing <Type, Capacity> :: value_type&& val) noexcept(std :: is_nothrow_move_constructible<Type>{})
+{
+ return try_emplace(std :: move(val));
+}
+
+template <class Type, std :: size_t Capacity> template <class ... Args> bool shMath :: fixedCapacityRing <Type, Capacity> :: try_emplace(Args&& ... args) noexcept(std :: is_nothrow_constructible<Type, Args&& ...>{})
+{
+ const size_type tail = Tail.load(std :: memory_order_relaxed);
+ if (distance(tail, CachedHead, powerOfTwo{}) == Capacity)
+ {
+  CachedHead = Head.load(std :: memory_order_acquire);
+  if (distance(tail, CachedHead, powerOfTwo{}) == Capacity)
+  {
+   return false;
+  }
+ }
+ new (Data + slot(tail, powerOfTwo{})) Type (std :: forward<Args>(args)...);
+ Tail.store(advance(tail, 1u, powerOfTwo{}), std :: memory_order_release);
+ return true;
+}
+
+template <class Type, std :: size_t Capacity> typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: try_push_n(const typename shMath :: fixedCapacityRing <Type, Capacity> :: value_type* first, typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type n)
+{
+ const size_type tail = Tail.load(std :: memory_order_relaxed);
+ size_type room = Capacity - distance(tail, CachedHead, powerOfTwo{});
+ if (room < n)
+ {
+  CachedHead = Head.load(std :: memory_order_acquire);
+  room = Capacity - distance(tail, CachedHead, powerOfTwo{});
+ }
+ const size_type count = std :: min(n, room);
+ const size_type start = slot(tail, powerOfTwo{});
+ const size_type wrapped = std :: min(count, Capacity - start);
+ Type* const result = reinterpret_cast<Type*>(Data);
+ fixedCapacityVectorUninitializedCopy(first, first + wrapped, result + start);
+ SH_MATH_TRY
+ {
+  fixedCapacityVectorUninitializedCopy(first + wrapped, first + count, result);
+ }
+ SH_MATH_CATCH_ALL
+ {
+  destroy(tail, wrapped);
+  SH_MATH_RETHROW;
+ }
+ Tail.store(advance(tail, count, powerOfTwo{}), std :: memory_order_release);
+ return count;
+}
+
+template <class Type, std :: size_t Capacity> bool shMath :: fixedCapacityRing <Type, Capacity> :: try_pop(typename shMath :: fixedCapacityRing <Type, Capacity> :: value_type& val) noexcept(std :: is_nothrow_move_assignable<Type>{} && std :: is_nothrow_destructible<Type>{})
+{
+ return (try_pop_n(std :: addressof(val), 1u) == 1u);
+}
+
+template <class Type, std :: size_t Capacity> typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: try_pop_n(typename shMath :: fixedCapacityRing <Type, Capacity> :: value_type* result, typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type n) noexcept(std :: is_nothrow_move_assignable<Type>{} && std :: is_nothrow_destructible<Type>{})
+{
+ const size_type head = Head.load(std :: memory_order_relaxed);
+ size_type available = distance(CachedTail, head, powerOfTwo{});
+ if (available < n)
+ {
+  CachedTail = Tail.load(std :: memory_order_acquire);
+  available = distance(CachedTail, head, powerOfTwo{});
+ }
+ const size_type count = std :: min(n, available);
+ const size_type start = slot(head, powerOfTwo{});
+ const size_type wrapped = std :: min(count, Capacity - start);
+ Type* const first = element(start);
+ result = std :: move(first, first + wrapped, result);
+ std :: move(element(0u), element(0u) + (count - wrapped), result);
+ destroy(head, count);
+ Head.store(advance(head, count, powerOfTwo{}), std :: memory_order_release);
+ return count;
+}
+
+#if (__cplusplus < 202002)
+#else
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: try_push_n(std :: span<const typename shMath :: fixedCapacityRing <Type, Capacity> :: value_type> values)
+{
+ return try_push_n(values.data(), values.size());
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: try_pop_n(std :: span<typename shMath :: fixedCapacityRing <Type, Capacity> :: value_type> values) noexcept(std :: is_nothrow_move_assignable<Type>{} && std :: is_nothrow_destructible<Type>{})
+{
+ return try_pop_n(values.data(), values.size());
+}
+#endif
+
+template <class Type, std :: size_t Capacity> inline Type* shMath :: fixedCapacityRing <Type, Capacity> :: element(typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type index) noexcept
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<Type*>(Data + index);
+ #else
+ return std :: launder(reinterpret_cast<Type*>(Data + index));
+ #endif
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityRing <Type, Capacity> :: destroy(typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type index, typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type n) noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ if (std :: is_trivially_destructible<Type> :: value)
+ {
+  return;
+ }
+ for(;n != 0u;--n,index = advance(index, 1u, powerOfTwo{})) element(slot(index, powerOfTwo{}))->~Type();
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: advance(typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type index, typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>) noexcept
+{
+ index += n;
+ return (index < 2u * Capacity) ? index : index - 2u * Capacity;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: advance(typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type index, typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>) noexcept
+{
+ return index + n;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: slot(typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type index, std :: integral_constant<bool, false>) noexcept
+{
+ return (index < Capacity) ? index : index - Capacity;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: slot(typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type index, std :: integral_constant<bool, true>) noexcept
+{
+ return index & (Capacity - 1u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: distance(typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type tail, typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type head, std :: integral_constant<bool, false>) noexcept
+{
+ return (tail < head) ? tail + 2u * Capacity - head : tail - head;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type shMath :: fixedCapacityRing <Type, Capacity> :: distance(typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type tail, typename shMath :: fixedCapacityRing <Type, Capacity> :: size_type head, std :: integral_constant<bool, true>) noexcept
+{
+ return tail - head;
+}
+#endif
+#endif
@@ -0,0 +1,446 @@
+#ifndef SH_MATH_FIXEDCAPACITYSLOTMAP
+#define SH_MATH_FIXEDCAPACITYSLOTMAP
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+namespace shMath
+{
+ //Names an element of a fixedCapacitySlotMap for as long as it lives; a default constructed handle never names anything.
+ struct fixedCapacitySlotMapHandle
+ {
+  constexpr fixedCapacitySlotMapHandle() noexcept;
+  constexpr fixedCapacitySlotMapHandle(std :: uint32_t index, std :: uint32_t generation) noexcept;
+  std :: uint32_t Index;
+  std :: uint32_t Generation;
+ };
+
+ constexpr bool operator == (const fixedCapacitySlotMapHandle& a, const fixedCapacitySlotMapHandle& b) noexcept;
+ constexpr bool operator != (const fixedCapacitySlotMapHandle& a, const fixedCapacitySlotMapHandle& b) noexcept;
+
+ //Elements packed at the front of an inline array for dense iteration, reached through generation tagged handles in O(1).
+ //Erasing moves the last element into the hole, so pointers and iterators move around but handles stay valid; a slot reused 2^32 times may alias a stale handle.
+ template <class Type, std :: size_t Capacity> class fixedCapacitySlotMap
+ {
+  static_assert(Capacity > 0u, "fixedCapacitySlotMap needs room for at least one element.");
+  static_assert(Capacity < 0xFFFFFFFFu, "fixedCapacitySlotMap handles store the slot in 32 bits.");
+  public:
+  typedef fixedCapacitySlotMapHandle handle;
+  typedef Type* pointer;
+  typedef Type& reference;
+  typedef const Type* const_pointer;
+  typedef const Type& const_reference;
+  typedef Type* iterator;
+  typedef const Type* const_iterator;
+  typedef std :: size_t size_type;
+  typedef std :: ptrdiff_t difference_type;
+  typedef Type value_type;
+  fixedCapacitySlotMap() noexcept;
+  fixedCapacitySlotMap(const fixedCapacitySlotMap& a);
+  fixedCapacitySlotMap(fixedCapacitySlotMap&& a) noexcept(std :: is_nothrow_move_constructible<Type>{});
+  ~fixedCapacitySlotMap();
+  fixedCapacitySlotMap& operator = (const fixedCapacitySlotMap& a);
+  fixedCapacitySlotMap& operator = (fixedCapacitySlotMap&& a) noexcept(std :: is_nothrow_move_constructible<Type>{});
+  constexpr size_type capacity() const noexcept;
+  constexpr size_type max_size() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  handle insert(const value_type& val);
+  handle insert(value_type&& val);
+  template <class ... Args> handle emplace(Args&& ... args);
+  //Returns a default constructed handle instead of throwing when the map is full.
+  template <class ... Args> handle try_emplace(Args&& ... args) noexcept(std :: is_nothrow_constructible<Type, Args&& ...>{});
+  //Returns false for a stale handle.
+  bool erase(const handle& h);
+  //Returns an iterator to the element moved into pos, so a loop erasing while iterating does not advance after an erase.
+  iterator erase(const_iterator pos);
+  pointer find(const handle& h) noexcept;
+  const_pointer find(const handle& h) const noexcept;
+  bool contains(const handle& h) const noexcept;
+  reference operator [] (const handle& h) noexcept;
+  const_reference operator [] (const handle& h) const noexcept;
+  reference at(const handle& h);
+  const_reference at(const handle& h) const;
+  handle handle_of(const_iterator pos) const noexcept;
+  pointer data() noexcept;
+  const_pointer data() const noexcept;
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+  //Invalidates every handle.
+  void clear() noexcept;
+  private:
+  typedef typename fixedCapacityVectorSizeType<Capacity> :: type index_type;
+  //Index is the dense position of a live element or the next free slot, Capacity ending the free list.
+  struct slot
+  {
+   index_type Index;
+   std :: uint32_t Generation;
+  };
+  Type* element(size_type n) noexcept;
+  const Type* element(size_type n) const noexcept;
+  //Dense position of the element named by h, or Capacity.
+  size_type locate(const handle& h) const noexcept;
+  template <class ... Args> handle place(Args&& ... args);
+  void eraseAt(size_type n);
+  void release(size_type s) noexcept;
+  void copyFrom(const fixedCapacitySlotMap& a);
+  void moveFrom(fixedCapacitySlotMap& a);
+  //Destroys the elements built by a copy or move that failed before taking over any slot; the slots and their generations stay as they were.
+  void destroy() noexcept;
+  alignas(Type) typename std :: aligned_storage <sizeof(Type), alignof(Type)> :: type Data[Capacity];
+  slot Slots[Capacity];
+  index_type Owners[Capacity];
+  index_type Size;
+  //Slots at or past Used were never handed out, so construction does not have to thread the free list through the whole array.
+  index_type Used;
+  index_type FreeHead;
+ };
+}
+
+constexpr inline shMath :: fixedCapacitySlotMapHandle :: fixedCapacitySlotMapHandle() noexcept
+: Index(0u), Generation(0u)
+{
+}
+
+constexpr inline shMath :: fixedCapacitySlotMapHandle :: fixedCapacitySlotMapHandle(std :: uint32_t index, std :: uint32_t generation) noexcept
+: Index(index), Generation(generation)
+{
+}
+
+constexpr inline bool shMath :: operator == (const shMath :: fixedCapacitySlotMapHandle& a, const shMath :: fixedCapacitySlotMapHandle& b) noexcept
+{
+ return (a.Index == b.Index) && (a.Generation == b.Generation);
+}
+
+constexpr inline bool shMath :: operator != (const shMath :: fixedCapacitySlotMapHandle& a, const shMath :: fixedCapacitySlotMapHandle& b) noexcept
+{
+ return !(a == b);
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacitySlotMap <Type, Capacity> :: fixedCapacitySlotMap() noexcept
+: Size(0u), Used(0u), FreeHead(Capacity)
+{
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacitySlotMap <Type, Capacity> :: fixedCapacitySlotMap(const shMath :: fixedCapacitySlotMap <Type, Capacity>& a)
+: Size(0u), Used(0u), FreeHead(Capacity)
+{
+ copyFrom(a);
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacitySlotMap <Type, Capacity> :: fixedCapacitySlotMap(shMath :: fixedCapacitySlotMap <Type, Capacity>&& a) noexcept(std :: is_nothrow_move_constructible<Type>{})
+: Size(0u), Used(0u), FreeHead(Capacity)
+{
+ moveFrom(a);
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacitySlotMap <Type, Capacity> :: ~fixedCapacitySlotMap()
+{
+ for(size_type n = Size;n != 0u;--n) element(n - 1u)->~Type();
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacitySlotMap <Type, Capacity>& shMath :: fixedCapacitySlotMap <Type, Capacity> :: operator = (const shMath :: fixedCapacitySlotMap <Type, Capacity>& a)
+{
+ if (this != &a)
+ {
+  clear(); //Moves every generation on, so the handles of the old elements stay stale even if the copy fails.
+  copyFrom(a);
+ }
+ return *this;
+}
+
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacitySlotMap <Type, Capacity>& shMath :: fixedCapacitySlotMap <Type, Capacity> :: operator = (shMath :: fixedCapacitySlotMap <Type, Capacity>&& a) noexcept(std :: is_nothrow_move_constructible<Type>{})
+{
+ if (this != &a)
+ {
+  clear();
+  moveFrom(a);
+ }
+ return *this;
+}
+
+template <class Type, std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: size_type shMath :: fixedCapacitySlotMap <Type, Capacity> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <class Type, std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: size_type shMath :: fixedCapacitySlotMap <Type, Capacity> :: max_size() const noexcept
+{
+ return Capacity;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: size_type shMath :: fixedCapacitySlotMap <Type, Capacity> :: size() const noexcept
+{
+ return Size;
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacitySlotMap <Type, Capacity> :: empty() const noexcept
+{
+ return (Size == 0u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle shMath :: fixedCapacitySlotMap <Type, Capacity> :: insert(const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: value_type& val)
+{
+ return emplace(val);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle shMath :: fixedCapacitySlotMap <Type, Capacity> :: insert(typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: value_type&& val)
+{
+ return emplace(std :: move(val));
+}
+
+template <class Type, std :: size_t Capacity> template <class ... Args> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle shMath :: fixedCapacitySlotMap <Type, Capacity> :: emplace(Args&& ... args)
+{
+ if (Size == Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ return place(std :: forward<Args>(args)...);
+}
+
+template <class Type, std :: size_t Capacity> template <class ... Args> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle shMath :: fixedCapacitySlotMap <Type, Capacity> :: try_emplace(Args&& ... args) noexcept(std :: is_nothrow_constructible<Type, Args&& ...>{})
+{
+ if (Size == Capacity)
+ {
+  fixedCapacityVectorRecordOverflow<Type, Capacity>();
+  return handle();
+ }
+ return place(std :: forward<Args>(args)...);
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacitySlotMap <Type, Capacity> :: erase(const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h)
+{
+ const size_type n = locate(h);
+ if (n == Capacity)
+ {
+  return false;
+ }
+ eraseAt(n);
+ return true;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: iterator shMath :: fixedCapacitySlotMap <Type, Capacity> :: erase(typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_iterator pos)
+{
+ const size_type n = static_cast<size_type>(pos - data());
+ eraseAt(n);
+ return data() + n;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: pointer shMath :: fixedCapacitySlotMap <Type, Capacity> :: find(const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h) noexcept
+{
+ const size_type n = locate(h);
+ return (n == Capacity) ? nullptr : element(n);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_pointer shMath :: fixedCapacitySlotMap <Type, Capacity> :: find(const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h) const noexcept
+{
+ const size_type n = locate(h);
+ return (n == Capacity) ? nullptr : element(n);
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacitySlotMap <Type, Capacity> :: contains(const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h) const noexcept
+{
+ return (locate(h) != Capacity);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: reference shMath :: fixedCapacitySlotMap <Type, Capacity> :: operator [] (const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h) noexcept
+{
+ return *element(Slots[h.Index].Index);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_reference shMath :: fixedCapacitySlotMap <Type, Capacity> :: operator [] (const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h) const noexcept
+{
+ return *element(Slots[h.Index].Index);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: reference shMath :: fixedCapacitySlotMap <Type, Capacity> :: at(const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h)
+{
+ const size_type n = locate(h);
+ if (n == Capacity)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *element(n);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_reference shMath :: fixedCapacitySlotMap <Type, Capacity> :: at(const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h) const
+{
+ const size_type n = locate(h);
+ if (n == Capacity)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *element(n);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle_of(typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_iterator pos) const noexcept
+{
+ const size_type s = Owners[pos - data()];
+ return handle(static_cast<std :: uint32_t>(s), Slots[s].Generation);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: pointer shMath :: fixedCapacitySlotMap <Type, Capacity> :: data() noexcept
+{
+ return element(0u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_pointer shMath :: fixedCapacitySlotMap <Type, Capacity> :: data() const noexcept
+{
+ return element(0u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: iterator shMath :: fixedCapacitySlotMap <Type, Capacity> :: begin() noexcept
+{
+ return data();
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_iterator shMath :: fixedCapacitySlotMap <Type, Capacity> :: begin() const noexcept
+{
+ return data();
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_iterator shMath :: fixedCapacitySlotMap <Type, Capacity> :: cbegin() const noexcept
+{
+ return data();
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: iterator shMath :: fixedCapacitySlotMap <Type, Capacity> :: end() noexcept
+{
+ return data() + Size;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_iterator shMath :: fixedCapacitySlotMap <Type, Capacity> :: end() const noexcept
+{
+ return data() + Size;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: const_iterator shMath :: fixedCapacitySlotMap <Type, Capacity> :: cend() const noexcept
+{
+ return data() + Size;
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySlotMap <Type, Capacity> :: clear() noexcept
+{
+ for(;Size != 0u;--Size)
+ {
+  element(Size - 1u)->~Type();
+  release(Owners[Size - 1u]);
+ }
+}
+
+template <class Type, std :: size_t Capacity> inline Type* shMath :: fixedCapacitySlotMap <Type, Capacity> :: element(typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: size_type n) noexcept
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<Type*>(Data + n);
+ #else
+ return std :: launder(reinterpret_cast<Type*>(Data + n));
+ #endif
+}
+
+template <class Type, std :: size_t Capacity> inline const Type* shMath :: fixedCapacitySlotMap <Type, Capacity> :: element(typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: size_type n) const noexcept
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<const Type*>(Data + n);
+ #else
+ return std :: launder(reinterpret_cast<const Type*>(Data + n));
+ #endif
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: size_type shMath :: fixedCapacitySlotMap <Type, Capacity> :: locate(const typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle& h) const noexcept
+{
+ //Generations are never zero and a free slot has moved past every handle given out for it, so a match means a live element.
+ if ((h.Index < Used) && (Slots[h.Index].Generation == h.Generation))
+ {
+  return Slots[h.Index].Index;
+ }
+ return Capacity;
+}
+
+template <class Type, std :: size_t Capacity> template <class ... Args> inline typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: handle shMath :: fixedCapacitySlotMap <Type, Capacity> :: place(Args&& ... args)
+{
+ new (Data + Size) Type (std :: forward<Args>(args)...);
+ size_type s = FreeHead;
+ if (s == Capacity)
+ {
+  s = Used++;
+  Slots[s].Generation = 1u;
+ }
+ else
+ {
+  FreeHead = Slots[s].Index;
+ }
+ Slots[s].Index = Size;
+ Owners[Size] = static_cast<index_type>(s);
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, Size + 1u);
+ ++Size;
+ return handle(static_cast<std :: uint32_t>(s), Slots[s].Generation);
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySlotMap <Type, Capacity> :: eraseAt(typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: size_type n)
+{
+ const size_type last = Size - 1u;
+ const size_type s = Owners[n];
+ if (n != last)
+ {
+  *element(n) = std :: move(*element(last));
+  Owners[n] = Owners[last];
+  Slots[Owners[n]].Index = static_cast<index_type>(n);
+ }
+ element(last)->~Type();
+ Size = static_cast<index_type>(last);
+ release(s);
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySlotMap <Type, Capacity> :: release(typename shMath :: fixedCapacitySlotMap <Type, Capacity> :: size_type s) noexcept
+{
+ std :: uint32_t generation = Slots[s].Generation + 1u;
+ Slots[s].Generation = (generation == 0u) ? 1u : generation;
+ Slots[s].Index = FreeHead;
+ FreeHead = static_cast<index_type>(s);
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySlotMap <Type, Capacity> :: copyFrom(const shMath :: fixedCapacitySlotMap <Type, Capacity>& a)
+{
+ SH_MATH_TRY
+ {
+  for(;Size != a.Size;++Size) new (Data + Size) Type (*a.element(Size));
+ }
+ SH_MATH_CATCH_ALL
+ {
+  destroy(); //Constructors rely on this, as a throwing constructor never runs the destructor.
+  SH_MATH_RETHROW;
+ }
+ std :: copy(a.Slots, a.Slots + a.Used, Slots);
+ std :: copy(a.Owners, a.Owners + a.Size, Owners);
+ Used = a.Used;
+ FreeHead = a.FreeHead;
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySlotMap <Type, Capacity> :: moveFrom(shMath :: fixedCapacitySlotMap <Type, Capacity>& a)
+{
+ SH_MATH_TRY
+ {
+  for(;Size != a.Size;++Size) new (Data + Size) Type (std :: move(*a.element(Size)));
+ }
+ SH_MATH_CATCH_ALL
+ {
+  destroy(); //Constructors rely on this, as a throwing constructor never runs the destructor.
+  SH_MATH_RETHROW;
+ }
+ std :: copy(a.Slots, a.Slots + a.Used, Slots);
+ std :: copy(a.Owners, a.Owners + a.Size, Owners);
+ Used = a.Used;
+ FreeHead = a.FreeHead;
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySlotMap <Type, Capacity> :: destroy() noexcept
+{
+ for(;Size != 0u;--Size) element(Size - 1u)->~Type();
+}
+#endif
+#endif
@@ -0,0 +1,416 @@
+#ifndef SH_MATH_FIXEDCAPACITYSOA
+#define SH_MATH_FIXEDCAPACITYSOA
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+#include <cstring>
+#include <tuple>
+
+#if (__cplusplus < 202002)
+#else
+#include <span>
+#endif
+
+namespace shMath
+{
+ template <std :: size_t ... Indices> struct fixedCapacitySoAIndices
+ {
+ };
+
+ template <std :: size_t N, std :: size_t ... Indices> struct fixedCapacitySoAMakeIndices : fixedCapacitySoAMakeIndices<N - 1u, N - 1u, Indices...>
+ {
+ };
+
+ template <std :: size_t ... Indices> struct fixedCapacitySoAMakeIndices<0u, Indices...>
+ {
+  typedef fixedCapacitySoAIndices<Indices...> type;
+ };
+
+ template <bool ... Conditions> struct fixedCapacitySoABools
+ {
+ };
+
+ template <bool ... Conditions> struct fixedCapacitySoAAll : std :: is_same<fixedCapacitySoABools<true, Conditions...>, fixedCapacitySoABools<Conditions..., true> >
+ {
+ };
+
+ //One uninitialized column per field, each starting on its own cache line so column loops vectorize with aligned loads.
+ template <std :: size_t Index, std :: size_t Capacity, class ... Fields> struct fixedCapacitySoAColumns
+ {
+  void column() noexcept;
+ };
+
+ template <std :: size_t Index, std :: size_t Capacity, class Head, class ... Tail> struct fixedCapacitySoAColumns<Index, Capacity, Head, Tail...> : fixedCapacitySoAColumns<Index + 1u, Capacity, Tail...>
+ {
+  using fixedCapacitySoAColumns<Index + 1u, Capacity, Tail...> :: column;
+  Head* column(std :: integral_constant<std :: size_t, Index>) noexcept;
+  const Head* column(std :: integral_constant<std :: size_t, Index>) const noexcept;
+  alignas(SH_MATH_CACHE_LINE_SIZE) alignas(Head) typename std :: aligned_storage <sizeof(Head), alignof(Head)> :: type Data[Capacity];
+ };
+
+ template <class Type> void fixedCapacitySoADestroy(Type* first, Type* last) noexcept(std :: is_nothrow_destructible<Type>{});
+
+ //Fixed capacity structure of arrays: row n is made of the n-th element of every column and all columns share one size counter.
+ template <std :: size_t Capacity, class ... Fields> class fixedCapacitySoA
+ {
+  static_assert(Capacity > 0u, "fixedCapacitySoA needs room for at least one row.");
+  static_assert(sizeof...(Fields) > 0u, "fixedCapacitySoA needs at least one field.");
+  public:
+  typedef std :: tuple<Fields...> value_type;
+  typedef std :: tuple<Fields& ...> reference;
+  typedef std :: tuple<const Fields& ...> const_reference;
+  typedef std :: size_t size_type;
+  typedef std :: ptrdiff_t difference_type;
+  template <std :: size_t I> using column_type = typename std :: tuple_element<I, value_type> :: type;
+  fixedCapacitySoA() noexcept;
+  fixedCapacitySoA(const fixedCapacitySoA& a);
+  fixedCapacitySoA(fixedCapacitySoA&& a) noexcept(fixedCapacitySoAAll<std :: is_nothrow_move_constructible<Fields> :: value...> :: value);
+  ~fixedCapacitySoA();
+  fixedCapacitySoA& operator = (const fixedCapacitySoA& a);
+  fixedCapacitySoA& operator = (fixedCapacitySoA&& a) noexcept(fixedCapacitySoAAll<std :: is_nothrow_move_constructible<Fields> :: value...> :: value);
+  constexpr size_type capacity() const noexcept;
+  constexpr size_type max_size() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  //Column accessors; I is the position of the field in Fields.
+  template <std :: size_t I> column_type<I>* data() noexcept;
+  template <std :: size_t I> const column_type<I>* data() const noexcept;
+  template <std :: size_t I> column_type<I>* begin() noexcept;
+  template <std :: size_t I> const column_type<I>* begin() const noexcept;
+  template <std :: size_t I> column_type<I>* end() noexcept;
+  template <std :: size_t I> const column_type<I>* end() const noexcept;
+  #if (__cplusplus < 202002)
+  #else
+  template <std :: size_t I> std :: span<column_type<I> > span() noexcept;
+  template <std :: size_t I> std :: span<const column_type<I> > span() const noexcept;
+  #endif
+  template <std :: size_t I> column_type<I>& get(size_type n) noexcept;
+  template <std :: size_t I> const column_type<I>& get(size_type n) const noexcept;
+  //Row accessors.
+  reference operator [] (size_type n) noexcept;
+  const_reference operator [] (size_type n) const noexcept;
+  reference at(size_type n);
+  const_reference at(size_type n) const;
+  reference back() noexcept;
+  const_reference back() const noexcept;
+  void push_back(const value_type& values);
+  void push_back(value_type&& values);
+  template <class ... Args> reference emplace_back(Args&& ... args);
+  void pop_back() noexcept(fixedCapacitySoAAll<std :: is_nothrow_destructible<Fields> :: value...> :: value);
+  void clear() noexcept(fixedCapacitySoAAll<std :: is_nothrow_destructible<Fields> :: value...> :: value);
+  private:
+  typedef typename fixedCapacitySoAMakeIndices<sizeof...(Fields)> :: type indices;
+  typedef std :: integral_constant<bool, fixedCapacitySoAAll<std :: is_trivially_copyable<Fields> :: value...> :: value> triviallyCopyable;
+  template <class Tuple> void appendRow(Tuple&& values);
+  template <class Tuple, std :: size_t I> void construct(size_type n, Tuple&& values, std :: integral_constant<std :: size_t, I>);
+  template <class Tuple> void construct(size_type n, Tuple&& values, std :: integral_constant<std :: size_t, sizeof...(Fields)>) noexcept;
+  template <std :: size_t ... I> reference row(size_type n, fixedCapacitySoAIndices<I...>) noexcept;
+  template <std :: size_t ... I> const_reference row(size_type n, fixedCapacitySoAIndices<I...>) const noexcept;
+  template <std :: size_t ... I> std :: tuple<Fields&& ...> moveRow(size_type n, fixedCapacitySoAIndices<I...>) noexcept;
+  template <std :: size_t ... I> void destroy(size_type first, size_type last, fixedCapacitySoAIndices<I...>) noexcept(fixedCapacitySoAAll<std :: is_nothrow_destructible<Fields> :: value...> :: value);
+  void copyFrom(const fixedCapacitySoA& a, std :: integral_constant<bool, false>);
+  void copyFrom(const fixedCapacitySoA& a, std :: integral_constant<bool, true>) noexcept;
+  void moveFrom(fixedCapacitySoA& a, std :: integral_constant<bool, false>);
+  void moveFrom(fixedCapacitySoA& a, std :: integral_constant<bool, true>) noexcept;
+  template <std :: size_t ... I> void copyColumns(const fixedCapacitySoA& a, fixedCapacitySoAIndices<I...>) noexcept;
+  fixedCapacitySoAColumns<0u, Capacity, Fields...> Columns;
+  typename fixedCapacityVectorSizeType<Capacity> :: type Size;
+ };
+}
+
+template <std :: size_t Index, std :: size_t Capacity, class Head, class ... Tail> inline Head* shMath :: fixedCapacitySoAColumns <Index, Capacity, Head, Tail...> :: column(std :: integral_constant<std :: size_t, Index>) noexcept
+{
+ return reinterpret_cast<Head*>(Data);
+}
+
+template <std :: size_t Index, std :: size_t Capacity, class Head, class ... Tail> inline const Head* shMath :: fixedCapacitySoAColumns <Index, Capacity, Head, Tail...> :: column(std :: integral_constant<std :: size_t, Index>) const noexcept
+{
+ return reinterpret_cast<const Head*>(Data);
+}
+
+template <class Type> inline void shMath :: fixedCapacitySoADestroy(Type* first, Type* last) noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ for(;first != last;++first) first->~Type();
+}
+
+template <std :: size_t Capacity, class ... Fields> inline shMath :: fixedCapacitySoA <Capacity, Fields...> :: fixedCapacitySoA() noexcept
+: Size(0u)
+{
+}
+
+template <std :: size_t Capacity, class ... Fields> inline shMath :: fixedCapacitySoA <Capacity, Fields...> :: fixedCapacitySoA(const shMath :: fixedCapacitySoA <Capacity, Fields...>& a)
+: Size(0u)
+{
+ copyFrom(a, triviallyCopyable{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline shMath :: fixedCapacitySoA <Capacity, Fields...> :: fixedCapacitySoA(shMath :: fixedCapacitySoA <Capacity, Fields...>&& a) noexcept(fixedCapacitySoAAll<std :: is_nothrow_move_constructible<Fields> :: value...> :: value)
+: Size(0u)
+{
+ moveFrom(a, triviallyCopyable{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline shMath :: fixedCapacitySoA <Capacity, Fields...> :: ~fixedCapacitySoA()
+{
+ destroy(0u, Size, indices{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline shMath :: fixedCapacitySoA <Capacity, Fields...>& shMath :: fixedCapacitySoA <Capacity, Fields...> :: operator = (const shMath :: fixedCapacitySoA <Capacity, Fields...>& a)
+{
+ if (this != &a)
+ {
+  clear();
+  copyFrom(a, triviallyCopyable{});
+ }
+ return *this;
+}
+
+template <std :: size_t Capacity, class ... Fields> inline shMath :: fixedCapacitySoA <Capacity, Fields...>& shMath :: fixedCapacitySoA <Capacity, Fields...> :: operator = (shMath :: fixedCapacitySoA <Capacity, Fields...>&& a) noexcept(fixedCapacitySoAAll<std :: is_nothrow_move_constructible<Fields> :: value...> :: value)
+{
+ if (this != &a)
+ {
+  clear();
+  moveFrom(a, triviallyCopyable{});
+ }
+ return *this;
+}
+
+template <std :: size_t Capacity, class ... Fields> constexpr inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type shMath :: fixedCapacitySoA <Capacity, Fields...> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <std :: size_t Capacity, class ... Fields> constexpr inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type shMath :: fixedCapacitySoA <Capacity, Fields...> :: max_size() const noexcept
+{
+ return Capacity;
+}
+
+template <std :: size_t Capacity, class ... Fields> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type shMath :: fixedCapacitySoA <Capacity, Fields...> :: size() const noexcept
+{
+ return Size;
+}
+
+template <std :: size_t Capacity, class ... Fields> inline bool shMath :: fixedCapacitySoA <Capacity, Fields...> :: empty() const noexcept
+{
+ return (Size == 0u);
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I>* shMath :: fixedCapacitySoA <Capacity, Fields...> :: data() noexcept
+{
+ return Columns.column(std :: integral_constant<std :: size_t, I>{});
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline const typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I>* shMath :: fixedCapacitySoA <Capacity, Fields...> :: data() const noexcept
+{
+ return Columns.column(std :: integral_constant<std :: size_t, I>{});
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I>* shMath :: fixedCapacitySoA <Capacity, Fields...> :: begin() noexcept
+{
+ return data<I>();
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline const typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I>* shMath :: fixedCapacitySoA <Capacity, Fields...> :: begin() const noexcept
+{
+ return data<I>();
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I>* shMath :: fixedCapacitySoA <Capacity, Fields...> :: end() noexcept
+{
+ return data<I>() + Size;
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline const typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I>* shMath :: fixedCapacitySoA <Capacity, Fields...> :: end() const noexcept
+{
+ return data<I>() + Size;
+}
+
+#if (__cplusplus < 202002)
+#else
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline std :: span<typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I> > shMath :: fixedCapacitySoA <Capacity, Fields...> :: span() noexcept
+{
+ return std :: span<column_type<I> >(data<I>(), Size);
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline std :: span<const typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I> > shMath :: fixedCapacitySoA <Capacity, Fields...> :: span() const noexcept
+{
+ return std :: span<const column_type<I> >(data<I>(), Size);
+}
+#endif
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I>& shMath :: fixedCapacitySoA <Capacity, Fields...> :: get(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n) noexcept
+{
+ return *(data<I>() + n);
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t I> inline const typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: template column_type<I>& shMath :: fixedCapacitySoA <Capacity, Fields...> :: get(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n) const noexcept
+{
+ return *(data<I>() + n);
+}
+
+template <std :: size_t Capacity, class ... Fields> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: operator [] (typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n) noexcept
+{
+ return row(n, indices{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: const_reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: operator [] (typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n) const noexcept
+{
+ return row(n, indices{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: at(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n)
+{
+ if (n >= Size)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return row(n, indices{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: const_reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: at(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n) const
+{
+ if (n >= Size)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return row(n, indices{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: back() noexcept
+{
+ return row(Size - 1u, indices{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: const_reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: back() const noexcept
+{
+ return row(Size - 1u, indices{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: push_back(const typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: value_type& values)
+{
+ appendRow(values);
+}
+
+template <std :: size_t Capacity, class ... Fields> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: push_back(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: value_type&& values)
+{
+ appendRow(std :: move(values));
+}
+
+template <std :: size_t Capacity, class ... Fields> template <class ... Args> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: emplace_back(Args&& ... args)
+{
+ static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back of fixedCapacitySoA takes one argument per field.");
+ appendRow(std :: forward_as_tuple(std :: forward<Args>(args)...));
+ return row(Size - 1u, indices{});
+}
+
+template <std :: size_t Capacity, class ... Fields> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: pop_back() noexcept(fixedCapacitySoAAll<std :: is_nothrow_destructible<Fields> :: value...> :: value)
+{
+ destroy(Size - 1u, Size, indices{});
+ --Size;
+}
+
+template <std :: size_t Capacity, class ... Fields> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: clear() noexcept(fixedCapacitySoAAll<std :: is_nothrow_destructible<Fields> :: value...> :: value)
+{
+ destroy(0u, Size, indices{});
+ Size = 0u;
+}
+
+template <std :: size_t Capacity, class ... Fields> template <class Tuple> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: appendRow(Tuple&& values)
+{
+ if (Size == Capacity)
+ {
+  fixedCapacityVectorOverflow<value_type, Capacity>();
+ }
+ construct(Size, std :: forward<Tuple>(values), std :: integral_constant<std :: size_t, 0u>{});
+ fixedCapacityVectorRecordGrowth<value_type, Capacity>(Size, Size + 1u);
+ ++Size;
+}
+
+//Builds row n column by column and unwinds the columns already built if a later one throws.
+template <std :: size_t Capacity, class ... Fields> template <class Tuple, std :: size_t I> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: construct(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n, Tuple&& values, std :: integral_constant<std :: size_t, I>)
+{
+ column_type<I>* const address = data<I>() + n;
+ new (address) column_type<I> (std :: get<I>(std :: forward<Tuple>(values)));
+ SH_MATH_TRY
+ {
+  construct(n, std :: forward<Tuple>(values), std :: integral_constant<std :: size_t, I + 1u>{});
+ }
+ SH_MATH_CATCH_ALL
+ {
+  fixedCapacitySoADestroy(address, address + 1);
+  SH_MATH_RETHROW;
+ }
+}
+
+template <std :: size_t Capacity, class ... Fields> template <class Tuple> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: construct(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type, Tuple&&, std :: integral_constant<std :: size_t, sizeof...(Fields)>) noexcept
+{
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t ... I> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: row(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n, shMath :: fixedCapacitySoAIndices<I...>) noexcept
+{
+ return reference(*(data<I>() + n)...);
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t ... I> inline typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: const_reference shMath :: fixedCapacitySoA <Capacity, Fields...> :: row(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n, shMath :: fixedCapacitySoAIndices<I...>) const noexcept
+{
+ return const_reference(*(data<I>() + n)...);
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t ... I> inline std :: tuple<Fields&& ...> shMath :: fixedCapacitySoA <Capacity, Fields...> :: moveRow(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type n, shMath :: fixedCapacitySoAIndices<I...>) noexcept
+{
+ return std :: tuple<Fields&& ...>(std :: move(*(data<I>() + n))...);
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t ... I> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: destroy(typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type first, typename shMath :: fixedCapacitySoA <Capacity, Fields...> :: size_type last, shMath :: fixedCapacitySoAIndices<I...>) noexcept(fixedCapacitySoAAll<std :: is_nothrow_destructible<Fields> :: value...> :: value)
+{
+ const int expand[] = {0, (fixedCapacitySoADestroy(data<I>() + first, data<I>() + last), 0)...};
+ static_cast<void>(expand);
+}
+
+template <std :: size_t Capacity, class ... Fields> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: copyFrom(const shMath :: fixedCapacitySoA <Capacity, Fields...>& a, std :: integral_constant<bool, false>)
+{
+ SH_MATH_TRY
+ {
+  for(size_type n = 0u;n != a.Size;++n) appendRow(a[n]);
+ }
+ SH_MATH_CATCH_ALL
+ {
+  clear(); //Constructors rely on this, as a throwing constructor never runs the destructor.
+  SH_MATH_RETHROW;
+ }
+}
+
+template <std :: size_t Capacity, class ... Fields> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: copyFrom(const shMath :: fixedCapacitySoA <Capacity, Fields...>& a, std :: integral_constant<bool, true>) noexcept
+{
+ copyColumns(a, indices{});
+ Size = a.Size;
+}
+
+template <std :: size_t Capacity, class ... Fields> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: moveFrom(shMath :: fixedCapacitySoA <Capacity, Fields...>& a, std :: integral_constant<bool, false>)
+{
+ SH_MATH_TRY
+ {
+  for(size_type n = 0u;n != a.Size;++n) appendRow(a.moveRow(n, indices{}));
+ }
+ SH_MATH_CATCH_ALL
+ {
+  clear(); //Constructors rely on this, as a throwing constructor never runs the destructor.
+  SH_MATH_RETHROW;
+ }
+}
+
+template <std :: size_t Capacity, class ... Fields> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: moveFrom(shMath :: fixedCapacitySoA <Capacity, Fields...>& a, std :: integral_constant<bool, true>) noexcept
+{
+ copyColumns(a, indices{});
+ Size = a.Size;
+}
+
+template <std :: size_t Capacity, class ... Fields> template <std :: size_t ... I> inline void shMath :: fixedCapacitySoA <Capacity, Fields...> :: copyColumns(const shMath :: fixedCapacitySoA <Capacity, Fields...>& a, shMath :: fixedCapacitySoAIndices<I...>) noexcept
+{
+ const int expand[] = {0, (std :: memcpy(static_cast<void*>(data<I>()), a.data<I>(), a.Size * sizeof(column_type<I>)), 0)...};
+ static_cast<void>(expand);
+}
+#endif
+#endif
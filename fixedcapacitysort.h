@@ -0,0 +1,413 @@
+#ifndef SH_MATH_FIXEDCAPACITYSORT
+#define SH_MATH_FIXEDCAPACITYSORT
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+#include <functional>
+#include <limits>
+
+//Vectors of arithmetic elements with a Capacity up to this, ordered by std :: less or std :: greater, are sorted by branchless sorting networks, larger ones and other comparisons by the standard algorithms; 0 disables the networks.
+#ifndef SH_MATH_SORT_NETWORK_CAPACITY
+#define SH_MATH_SORT_NETWORK_CAPACITY 32
+#endif
+
+namespace shMath
+{
+ //One comparison feeding two selects, which compiles to cmov or pmin and pmax; exchanges past Limit only ever meet padding and are left out.
+ template <std :: size_t Limit, std :: size_t I, std :: size_t J, bool Active = (J < Limit)> struct fixedCapacitySortExchange
+ {
+  template <class Type> static void apply(Type* a) noexcept;
+ };
+
+ template <std :: size_t Limit, std :: size_t I, std :: size_t J> struct fixedCapacitySortExchange<Limit, I, J, false>
+ {
+  template <class Type> static void apply(Type* a) noexcept;
+ };
+
+ //Batcher odd-even merge sort of the power of two range [Low, High], unrolled at compile time so every index is a constant, and pruned to the first Limit elements.
+ template <std :: size_t Limit, std :: size_t Low, std :: size_t High, bool Split = (High > Low)> struct fixedCapacitySortNetwork
+ {
+  template <class Type> static void apply(Type* a) noexcept;
+ };
+
+ template <std :: size_t Limit, std :: size_t Low, std :: size_t High> struct fixedCapacitySortNetwork<Limit, Low, High, false>
+ {
+  template <class Type> static void apply(Type* a) noexcept;
+ };
+
+ template <std :: size_t Limit, std :: size_t Low, std :: size_t High, std :: size_t Distance, bool Split = (2u * Distance < High - Low)> struct fixedCapacitySortMerge
+ {
+  template <class Type> static void apply(Type* a) noexcept;
+ };
+
+ template <std :: size_t Limit, std :: size_t Low, std :: size_t High, std :: size_t Distance> struct fixedCapacitySortMerge<Limit, Low, High, Distance, false>
+ {
+  template <class Type> static void apply(Type* a) noexcept;
+ };
+
+ //Exchanges (I, I + Distance) for I running up to End in steps of Step.
+ template <std :: size_t Limit, std :: size_t I, std :: size_t End, std :: size_t Step, std :: size_t Distance, bool More = (I < End)> struct fixedCapacitySortMergeStep
+ {
+  template <class Type> static void apply(Type* a) noexcept;
+ };
+
+ template <std :: size_t Limit, std :: size_t I, std :: size_t End, std :: size_t Step, std :: size_t Distance> struct fixedCapacitySortMergeStep<Limit, I, End, Step, Distance, false>
+ {
+  template <class Type> static void apply(Type* a) noexcept;
+ };
+
+ //Runs the smallest network of N = 2, 4, ... Last elements that holds n, so a short vector of a large Capacity does not pay for the whole network.
+ //The elements past n up to the network size, never more than Capacity, are padded with the largest value so the first n outputs are the sorted elements.
+ template <std :: size_t N, std :: size_t Last, std :: size_t Capacity> struct fixedCapacitySortDispatch
+ {
+  template <class Type> static void apply(Type* a, std :: size_t n) noexcept;
+ };
+
+ template <std :: size_t Last, std :: size_t Capacity> struct fixedCapacitySortDispatch<Last, Last, Capacity>
+ {
+  template <class Type> static void apply(Type* a, std :: size_t n) noexcept;
+ };
+
+ template <std :: size_t Capacity, std :: size_t N = 2u, bool Done = (N >= Capacity)> struct fixedCapacitySortNetworkSize
+ {
+  static constexpr std :: size_t value = fixedCapacitySortNetworkSize<Capacity, 2u * N> :: value;
+ };
+
+ template <std :: size_t Capacity, std :: size_t N> struct fixedCapacitySortNetworkSize<Capacity, N, true>
+ {
+  static constexpr std :: size_t value = N;
+ };
+
+ //Integers are sorted in place. IEEE float and double go through unsigned keys in the same order, because compilers turn a float select into a branch but an integer one into a cmov.
+ template <class Type, class = void> struct fixedCapacitySortKey : std :: integral_constant<bool, false>
+ {
+ };
+
+ template <class Type> struct fixedCapacitySortKey<Type, typename std :: enable_if<std :: is_integral<Type> :: value> :: type> : std :: integral_constant<bool, true>
+ {
+  typedef Type type;
+ };
+
+ template <class Type> struct fixedCapacitySortKey<Type, typename std :: enable_if<std :: is_floating_point<Type> :: value && std :: numeric_limits<Type> :: is_iec559 && ((sizeof(Type) == 4u) || (sizeof(Type) == 8u))> :: type> : std :: integral_constant<bool, true>
+ {
+  typedef typename fixedCapacityVectorSelect<(sizeof(Type) == 4u), std :: uint32_t, std :: uint64_t> :: type type;
+  //Negative values get all bits flipped and the others only the sign bit, so -0.0 sorts just before +0.0.
+  static type to(const Type& value) noexcept;
+  static Type from(const type& key) noexcept;
+ };
+
+ template <class Compare, class Type> struct fixedCapacitySortIsLess : std :: integral_constant<bool, std :: is_same<Compare, std :: less<Type> > :: value || std :: is_same<Compare, std :: less<void> > :: value>
+ {
+ };
+
+ //The networks sort ascending; std :: greater reverses their output, which only swaps equal elements when they are indistinguishable anyway.
+ template <class Compare, class Type> struct fixedCapacitySortIsGreater : std :: integral_constant<bool, std :: is_same<Compare, std :: greater<Type> > :: value || std :: is_same<Compare, std :: greater<void> > :: value>
+ {
+ };
+
+ //A network is not stable, which only goes unnoticed when equal elements are indistinguishable, so stable sorts keep it to integers.
+ template <class Type, std :: size_t Capacity, class Compare, bool Stable> struct fixedCapacitySortUsesNetwork : std :: integral_constant<bool, (Capacity <= SH_MATH_SORT_NETWORK_CAPACITY) && fixedCapacitySortKey<Type> :: value && (fixedCapacitySortIsLess<Compare, Type> :: value || fixedCapacitySortIsGreater<Compare, Type> :: value) && (!Stable || std :: is_integral<Type> :: value)>
+ {
+ };
+
+ //first has room for Capacity elements, which the integer path uses for padding.
+ template <class Type, std :: size_t Capacity> void fixedCapacitySortNetworkRange(Type* first, std :: size_t n) noexcept;
+ template <class Type, std :: size_t Capacity> void fixedCapacitySortNetworkRange(Type* first, std :: size_t n, std :: integral_constant<bool, false>) noexcept;
+ template <class Type, std :: size_t Capacity> void fixedCapacitySortNetworkRange(Type* first, std :: size_t n, std :: integral_constant<bool, true>) noexcept;
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacitySortNetworkOrder(Type* first, std :: size_t n) noexcept;
+ //first + n, bounded by Capacity so GCC drops the branches of the standard algorithms for longer ranges instead of reporting them under -Warray-bounds.
+ template <class Type, std :: size_t Capacity> Type* fixedCapacitySortEnd(Type* first, std :: size_t n) noexcept;
+
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacitySort(Type* first, std :: size_t n, Compare comp, std :: integral_constant<bool, false>);
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacitySort(Type* first, std :: size_t n, Compare comp, std :: integral_constant<bool, true>) noexcept;
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacityStableSort(Type* first, std :: size_t n, Compare comp, std :: integral_constant<bool, false>);
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacityStableSort(Type* first, std :: size_t n, Compare comp, std :: integral_constant<bool, true>) noexcept;
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacityPartialSort(Type* first, Type* middle, std :: size_t n, Compare comp, std :: integral_constant<bool, false>);
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacityPartialSort(Type* first, Type* middle, std :: size_t n, Compare comp, std :: integral_constant<bool, true>) noexcept;
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacityNthElement(Type* first, Type* nth, std :: size_t n, Compare comp, std :: integral_constant<bool, false>);
+ template <class Type, std :: size_t Capacity, class Compare> void fixedCapacityNthElement(Type* first, Type* nth, std :: size_t n, Compare comp, std :: integral_constant<bool, true>) noexcept;
+
+ //Same contracts as the standard algorithms; a fully sorted vector satisfies partial_sort and nth_element, which is what the networks deliver.
+ template <class Type, std :: size_t Capacity> void sort(fixedCapacityVector<Type, Capacity>& a);
+ template <class Type, std :: size_t Capacity, class Compare> void sort(fixedCapacityVector<Type, Capacity>& a, Compare comp);
+ template <class Type, std :: size_t Capacity> void stable_sort(fixedCapacityVector<Type, Capacity>& a);
+ template <class Type, std :: size_t Capacity, class Compare> void stable_sort(fixedCapacityVector<Type, Capacity>& a, Compare comp);
+ template <class Type, std :: size_t Capacity> void partial_sort(fixedCapacityVector<Type, Capacity>& a, typename fixedCapacityVector<Type, Capacity> :: iterator middle);
+ template <class Type, std :: size_t Capacity, class Compare> void partial_sort(fixedCapacityVector<Type, Capacity>& a, typename fixedCapacityVector<Type, Capacity> :: iterator middle, Compare comp);
+ template <class Type, std :: size_t Capacity> void nth_element(fixedCapacityVector<Type, Capacity>& a, typename fixedCapacityVector<Type, Capacity> :: iterator nth);
+ template <class Type, std :: size_t Capacity, class Compare> void nth_element(fixedCapacityVector<Type, Capacity>& a, typename fixedCapacityVector<Type, Capacity> :: iterator nth, Compare comp);
+ //Packed bool vectors have no data(), so they are sorted by counting the true bits and refilling both runs.
+ template <std :: size_t Capacity, class Compare> void fixedCapacitySortBools(fixedCapacityVector<bool, Capacity>& a, Compare comp);
+ template <std :: size_t Capacity> void sort(fixedCapacityVector<bool, Capacity>& a);
+ template <std :: size_t Capacity, class Compare> void sort(fixedCapacityVector<bool, Capacity>& a, Compare comp);
+ template <std :: size_t Capacity> void stable_sort(fixedCapacityVector<bool, Capacity>& a);
+ template <std :: size_t Capacity, class Compare> void stable_sort(fixedCapacityVector<bool, Capacity>& a, Compare comp);
+ template <std :: size_t Capacity> void partial_sort(fixedCapacityVector<bool, Capacity>& a, typename fixedCapacityVector<bool, Capacity> :: iterator middle);
+ template <std :: size_t Capacity, class Compare> void partial_sort(fixedCapacityVector<bool, Capacity>& a, typename fixedCapacityVector<bool, Capacity> :: iterator middle, Compare comp);
+ template <std :: size_t Capacity> void nth_element(fixedCapacityVector<bool, Capacity>& a, typename fixedCapacityVector<bool, Capacity> :: iterator nth);
+ template <std :: size_t Capacity, class Compare> void nth_element(fixedCapacityVector<bool, Capacity>& a, typename fixedCapacityVector<bool, Capacity> :: iterator nth, Compare comp);
+}
+
+#if (__cplusplus < 201703)
+template <std :: size_t Capacity, std :: size_t N, bool Done> constexpr std :: size_t shMath :: fixedCapacitySortNetworkSize <Capacity, N, Done> :: value;
+template <std :: size_t Capacity, std :: size_t N> constexpr std :: size_t shMath :: fixedCapacitySortNetworkSize <Capacity, N, true> :: value;
+#endif
+
+template <std :: size_t Limit, std :: size_t I, std :: size_t J, bool Active> template <class Type> inline void shMath :: fixedCapacitySortExchange <Limit, I, J, Active> :: apply(Type* a) noexcept
+{
+ const Type x = a[I];
+ const Type y = a[J];
+ const bool swap = y < x;
+ a[I] = swap ? y : x;
+ a[J] = swap ? x : y;
+}
+
+template <std :: size_t Limit, std :: size_t I, std :: size_t J> template <class Type> inline void shMath :: fixedCapacitySortExchange <Limit, I, J, false> :: apply(Type*) noexcept
+{
+}
+
+template <std :: size_t Limit, std :: size_t Low, std :: size_t High, bool Split> template <class Type> inline void shMath :: fixedCapacitySortNetwork <Limit, Low, High, Split> :: apply(Type* a) noexcept
+{
+ fixedCapacitySortNetwork<Limit, Low, Low + (High - Low) / 2u> :: apply(a);
+ fixedCapacitySortNetwork<Limit, Low + (High - Low) / 2u + 1u, High> :: apply(a);
+ fixedCapacitySortMerge<Limit, Low, High, 1u> :: apply(a);
+}
+
+template <std :: size_t Limit, std :: size_t Low, std :: size_t High> template <class Type> inline void shMath :: fixedCapacitySortNetwork <Limit, Low, High, false> :: apply(Type*) noexcept
+{
+}
+
+template <std :: size_t Limit, std :: size_t Low, std :: size_t High, std :: size_t Distance, bool Split> template <class Type> inline void shMath :: fixedCapacitySortMerge <Limit, Low, High, Distance, Split> :: apply(Type* a) noexcept
+{
+ fixedCapacitySortMerge<Limit, Low, High, 2u * Distance> :: apply(a);
+ fixedCapacitySortMerge<Limit, Low + Distance, High, 2u * Distance> :: apply(a);
+ fixedCapacitySortMergeStep<Limit, Low + Distance, High - Distance, 2u * Distance, Distance> :: apply(a);
+}
+
+template <std :: size_t Limit, std :: size_t Low, std :: size_t High, std :: size_t Distance> template <class Type> inline void shMath :: fixedCapacitySortMerge <Limit, Low, High, Distance, false> :: apply(Type* a) noexcept
+{
+ fixedCapacitySortExchange<Limit, Low, Low + Distance> :: apply(a);
+}
+
+template <std :: size_t Limit, std :: size_t I, std :: size_t End, std :: size_t Step, std :: size_t Distance, bool More> template <class Type> inline void shMath :: fixedCapacitySortMergeStep <Limit, I, End, Step, Distance, More> :: apply(Type* a) noexcept
+{
+ fixedCapacitySortExchange<Limit, I, I + Distance> :: apply(a);
+ fixedCapacitySortMergeStep<Limit, I + Step, End, Step, Distance> :: apply(a);
+}
+
+template <std :: size_t Limit, std :: size_t I, std :: size_t End, std :: size_t Step, std :: size_t Distance> template <class Type> inline void shMath :: fixedCapacitySortMergeStep <Limit, I, End, Step, Distance, false> :: apply(Type*) noexcept
+{
+}
+
+template <std :: size_t N, std :: size_t Last, std :: size_t Capacity> template <class Type> inline void shMath :: fixedCapacitySortDispatch <N, Last, Capacity> :: apply(Type* a, std :: size_t n) noexcept
+{
+ if (n <= N)
+ {
+  for(std :: size_t i = n;i < ((N < Capacity) ? N : Capacity);++i) a[i] = (std :: numeric_limits<Type> :: max)();
+  fixedCapacitySortNetwork<((N < Capacity) ? N : Capacity), 0u, N - 1u> :: apply(a);
+ }
+ else
+ {
+  fixedCapacitySortDispatch<2u * N, Last, Capacity> :: apply(a, n);
+ }
+}
+
+template <std :: size_t Last, std :: size_t Capacity> template <class Type> inline void shMath :: fixedCapacitySortDispatch <Last, Last, Capacity> :: apply(Type* a, std :: size_t n) noexcept
+{
+ for(std :: size_t i = n;i < Capacity;++i) a[i] = (std :: numeric_limits<Type> :: max)();
+ fixedCapacitySortNetwork<Capacity, 0u, Last - 1u> :: apply(a);
+}
+
+template <class Type> inline typename shMath :: fixedCapacitySortKey <Type, typename std :: enable_if<std :: is_floating_point<Type> :: value && std :: numeric_limits<Type> :: is_iec559 && ((sizeof(Type) == 4u) || (sizeof(Type) == 8u))> :: type> :: type shMath :: fixedCapacitySortKey <Type, typename std :: enable_if<std :: is_floating_point<Type> :: value && std :: numeric_limits<Type> :: is_iec559 && ((sizeof(Type) == 4u) || (sizeof(Type) == 8u))> :: type> :: to(const Type& value) noexcept
+{
+ const type sign = static_cast<type>(1u) << (sizeof(type) * CHAR_BIT - 1u);
+ type bits;
+ std :: memcpy(&bits, &value, sizeof(type));
+ return bits ^ (static_cast<type>(0u - (bits >> (sizeof(type) * CHAR_BIT - 1u))) | sign);
+}
+
+template <class Type> inline Type shMath :: fixedCapacitySortKey <Type, typename std :: enable_if<std :: is_floating_point<Type> :: value && std :: numeric_limits<Type> :: is_iec559 && ((sizeof(Type) == 4u) || (sizeof(Type) == 8u))> :: type> :: from(const type& key) noexcept
+{
+ const type sign = static_cast<type>(1u) << (sizeof(type) * CHAR_BIT - 1u);
+ const type bits = key ^ (static_cast<type>((key >> (sizeof(type) * CHAR_BIT - 1u)) - 1u) | sign);
+ Type value;
+ std :: memcpy(&value, &bits, sizeof(type));
+ return value;
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySortNetworkRange(Type* first, std :: size_t n) noexcept
+{
+ if (n < 2u)
+ {
+  return;
+ }
+ fixedCapacitySortNetworkRange<Type, Capacity>(first, n, std :: is_integral<Type>{});
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySortNetworkRange(Type* first, std :: size_t n, std :: integral_constant<bool, false>) noexcept
+{
+ typedef fixedCapacitySortKey<Type> key;
+ typename key :: type keys[Capacity];
+ for(std :: size_t i = 0u;i != n;++i) keys[i] = key :: to(first[i]);
+ fixedCapacitySortDispatch<2u, fixedCapacitySortNetworkSize<Capacity> :: value, Capacity> :: apply(keys, n);
+ for(std :: size_t i = 0u;i != n;++i) first[i] = key :: from(keys[i]);
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacitySortNetworkRange(Type* first, std :: size_t n, std :: integral_constant<bool, true>) noexcept
+{
+ fixedCapacitySortDispatch<2u, fixedCapacitySortNetworkSize<Capacity> :: value, Capacity> :: apply(first, n);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacitySortNetworkOrder(Type* first, std :: size_t n) noexcept
+{
+ fixedCapacitySortNetworkRange<Type, Capacity>(first, n);
+ if (fixedCapacitySortIsGreater<Compare, Type> :: value)
+ {
+  std :: reverse(first, fixedCapacitySortEnd<Type, Capacity>(first, n));
+ }
+}
+
+template <class Type, std :: size_t Capacity> inline Type* shMath :: fixedCapacitySortEnd(Type* first, std :: size_t n) noexcept
+{
+ return first + ((n < Capacity) ? n : Capacity);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacitySort(Type* first, std :: size_t n, Compare comp, std :: integral_constant<bool, false>)
+{
+ std :: sort(first, fixedCapacitySortEnd<Type, Capacity>(first, n), comp);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacitySort(Type* first, std :: size_t n, Compare, std :: integral_constant<bool, true>) noexcept
+{
+ fixedCapacitySortNetworkOrder<Type, Capacity, Compare>(first, n);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityStableSort(Type* first, std :: size_t n, Compare comp, std :: integral_constant<bool, false>)
+{
+ std :: stable_sort(first, fixedCapacitySortEnd<Type, Capacity>(first, n), comp);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityStableSort(Type* first, std :: size_t n, Compare, std :: integral_constant<bool, true>) noexcept
+{
+ fixedCapacitySortNetworkOrder<Type, Capacity, Compare>(first, n);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityPartialSort(Type* first, Type* middle, std :: size_t n, Compare comp, std :: integral_constant<bool, false>)
+{
+ std :: partial_sort(first, middle, fixedCapacitySortEnd<Type, Capacity>(first, n), comp);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityPartialSort(Type* first, Type*, std :: size_t n, Compare, std :: integral_constant<bool, true>) noexcept
+{
+ fixedCapacitySortNetworkOrder<Type, Capacity, Compare>(first, n);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityNthElement(Type* first, Type* nth, std :: size_t n, Compare comp, std :: integral_constant<bool, false>)
+{
+ std :: nth_element(first, nth, fixedCapacitySortEnd<Type, Capacity>(first, n), comp);
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacityNthElement(Type* first, Type*, std :: size_t n, Compare, std :: integral_constant<bool, true>) noexcept
+{
+ fixedCapacitySortNetworkOrder<Type, Capacity, Compare>(first, n);
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: sort(shMath :: fixedCapacityVector<Type, Capacity>& a)
+{
+ sort(a, std :: less<Type>());
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: sort(shMath :: fixedCapacityVector<Type, Capacity>& a, Compare comp)
+{
+ fixedCapacitySort<Type, Capacity>(a.data(), a.size(), comp, fixedCapacitySortUsesNetwork<Type, Capacity, Compare, false>{});
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: stable_sort(shMath :: fixedCapacityVector<Type, Capacity>& a)
+{
+ stable_sort(a, std :: less<Type>());
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: stable_sort(shMath :: fixedCapacityVector<Type, Capacity>& a, Compare comp)
+{
+ fixedCapacityStableSort<Type, Capacity>(a.data(), a.size(), comp, fixedCapacitySortUsesNetwork<Type, Capacity, Compare, true>{});
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: partial_sort(shMath :: fixedCapacityVector<Type, Capacity>& a, typename shMath :: fixedCapacityVector<Type, Capacity> :: iterator middle)
+{
+ partial_sort(a, middle, std :: less<Type>());
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: partial_sort(shMath :: fixedCapacityVector<Type, Capacity>& a, typename shMath :: fixedCapacityVector<Type, Capacity> :: iterator middle, Compare comp)
+{
+ fixedCapacityPartialSort<Type, Capacity>(a.data(), middle, a.size(), comp, fixedCapacitySortUsesNetwork<Type, Capacity, Compare, false>{});
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: nth_element(shMath :: fixedCapacityVector<Type, Capacity>& a, typename shMath :: fixedCapacityVector<Type, Capacity> :: iterator nth)
+{
+ nth_element(a, nth, std :: less<Type>());
+}
+
+template <class Type, std :: size_t Capacity, class Compare> inline void shMath :: nth_element(shMath :: fixedCapacityVector<Type, Capacity>& a, typename shMath :: fixedCapacityVector<Type, Capacity> :: iterator nth, Compare comp)
+{
+ fixedCapacityNthElement<Type, Capacity>(a.data(), nth, a.size(), comp, fixedCapacitySortUsesNetwork<Type, Capacity, Compare, false>{});
+}
+
+template <std :: size_t Capacity, class Compare> inline void shMath :: fixedCapacitySortBools(shMath :: fixedCapacityVector<bool, Capacity>& a, Compare comp)
+{
+ const std :: size_t n = a.size();
+ const std :: size_t ones = a.count();
+ if (comp(false, true))
+ {
+  a.assign(n - ones, false);
+  a.resize(n, true);
+ }
+ else if (comp(true, false))
+ {
+  a.assign(ones, true);
+  a.resize(n, false);
+ }
+}
+
+template <std :: size_t Capacity> inline void shMath :: sort(shMath :: fixedCapacityVector<bool, Capacity>& a)
+{
+ fixedCapacitySortBools(a, std :: less<bool>());
+}
+
+template <std :: size_t Capacity, class Compare> inline void shMath :: sort(shMath :: fixedCapacityVector<bool, Capacity>& a, Compare comp)
+{
+ fixedCapacitySortBools(a, comp);
+}
+
+template <std :: size_t Capacity> inline void shMath :: stable_sort(shMath :: fixedCapacityVector<bool, Capacity>& a)
+{
+ fixedCapacitySortBools(a, std :: less<bool>());
+}
+
+template <std :: size_t Capacity, class Compare> inline void shMath :: stable_sort(shMath :: fixedCapacityVector<bool, Capacity>& a, Compare comp)
+{
+ fixedCapacitySortBools(a, comp);
+}
+
+template <std :: size_t Capacity> inline void shMath :: partial_sort(shMath :: fixedCapacityVector<bool, Capacity>& a, typename shMath :: fixedCapacityVector<bool, Capacity> :: iterator)
+{
+ fixedCapacitySortBools(a, std :: less<bool>());
+}
+
+template <std :: size_t Capacity, class Compare> inline void shMath :: partial_sort(shMath :: fixedCapacityVector<bool, Capacity>& a, typename shMath :: fixedCapacityVector<bool, Capacity> :: iterator, Compare comp)
+{
+ fixedCapacitySortBools(a, comp);
+}
+
+template <std :: size_t Capacity> inline void shMath :: nth_element(shMath :: fixedCapacityVector<bool, Capacity>& a, typename shMath :: fixedCapacityVector<bool, Capacity> :: iterator)
+{
+ fixedCapacitySortBools(a, std :: less<bool>());
+}
+
+template <std :: size_t Capacity, class Compare> inline void shMath :: nth_element(shMath :: fixedCapacityVector<bool, Capacity>& a, typename shMath :: fixedCapacityVector<bool, Capacity> :: iterator, Compare comp)
+{
+ fixedCapacitySortBools(a, comp);
+}
+#endif
+#endif
@@ -0,0 +1,756 @@
+#ifndef SH_MATH_FIXEDCAPACITYSTRING
+#define SH_MATH_FIXEDCAPACITYSTRING
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+#include <functional>
+#include <ostream>
+#include <string>
+
+#if (__cplusplus < 201703)
+#else
+#include <string_view>
+#endif
+
+#if (__cplusplus < 202002)
+#else
+#include <version>
+#ifdef __cpp_lib_format
+#include <format>
+#endif
+#endif
+
+namespace shMath
+{
+ //Up to Capacity characters in a fixedCapacityVector <char, Capacity + 1> that always ends with the null terminator, so c_str() costs nothing.
+ template <std :: size_t Capacity> class fixedCapacityString
+ {
+  template <std :: size_t AnotherCapacity> friend class fixedCapacityString;
+  public:
+  typedef char value_type;
+  typedef std :: char_traits<char> traits_type;
+  typedef char* pointer;
+  typedef char& reference;
+  typedef const char* const_pointer;
+  typedef const char& const_reference;
+  typedef char* iterator;
+  typedef const char* const_iterator;
+  typedef std :: reverse_iterator<iterator> reverse_iterator;
+  typedef std :: reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef std :: size_t size_type;
+  typedef std :: ptrdiff_t difference_type;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+  fixedCapacityString();
+  fixedCapacityString(const char* s);
+  fixedCapacityString(const char* s, size_type n);
+  fixedCapacityString(size_type n, char c);
+  template <std :: size_t AnotherCapacity> fixedCapacityString(const fixedCapacityString<AnotherCapacity>& a);
+  template <std :: size_t AnotherCapacity> explicit fixedCapacityString(const fixedCapacityVector<char, AnotherCapacity>& a);
+  explicit fixedCapacityString(const std :: string& a);
+  #if (__cplusplus < 201703)
+  #else
+  explicit fixedCapacityString(std :: string_view a);
+  #endif
+  fixedCapacityString& operator = (const char* s);
+  template <std :: size_t AnotherCapacity> fixedCapacityString& operator = (const fixedCapacityString<AnotherCapacity>& a);
+  constexpr size_type capacity() const noexcept;
+  constexpr size_type max_size() const noexcept;
+  size_type size() const noexcept;
+  size_type length() const noexcept;
+  bool empty() const noexcept;
+  const char* c_str() const noexcept;
+  char* data() noexcept;
+  const char* data() const noexcept;
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+  reverse_iterator rbegin() noexcept;
+  const_reverse_iterator rbegin() const noexcept;
+  reverse_iterator rend() noexcept;
+  const_reverse_iterator rend() const noexcept;
+  reference operator [] (size_type n) noexcept;
+  const_reference operator [] (size_type n) const noexcept;
+  reference at(size_type n);
+  const_reference at(size_type n) const;
+  reference front() noexcept;
+  const_reference front() const noexcept;
+  reference back() noexcept;
+  const_reference back() const noexcept;
+  #if (__cplusplus < 201703)
+  #else
+  std :: string_view view() const noexcept;
+  operator std :: string_view() const noexcept;
+  #endif
+  std :: string str() const;
+  //Appends check the capacity once for the whole piece, then copy it with memcpy.
+  fixedCapacityString& append(const char* s, size_type n);
+  fixedCapacityString& append(const char* s);
+  fixedCapacityString& append(size_type n, char c);
+  template <std :: size_t AnotherCapacity> fixedCapacityString& append(const fixedCapacityString<AnotherCapacity>& a);
+  fixedCapacityString& append(const std :: string& a);
+  #if (__cplusplus < 201703)
+  #else
+  fixedCapacityString& append(std :: string_view a);
+  #endif
+  //Appends as much as fits and reports whether everything did, for paths such as logging that must truncate rather than throw.
+  bool try_append(const char* s, size_type n) noexcept;
+  fixedCapacityString& operator += (char c);
+  fixedCapacityString& operator += (const char* s);
+  template <std :: size_t AnotherCapacity> fixedCapacityString& operator += (const fixedCapacityString<AnotherCapacity>& a);
+  fixedCapacityString& operator += (const std :: string& a);
+  #if (__cplusplus < 201703)
+  #else
+  fixedCapacityString& operator += (std :: string_view a);
+  #endif
+  void push_back(char c);
+  void pop_back() noexcept;
+  void resize(size_type n, char c = '\0');
+  void clear() noexcept;
+  //find (char) uses the SSE2 or AVX2 search of fixedCapacityVector.
+  size_type find(char c, size_type pos = 0u) const noexcept;
+  size_type find(const char* s, size_type pos, size_type n) const noexcept;
+  size_type find(const char* s, size_type pos = 0u) const noexcept;
+  bool contains(char c) const noexcept;
+  bool contains(const char* s) const noexcept;
+  bool starts_with(const char* s) const noexcept;
+  bool ends_with(const char* s) const noexcept;
+  int compare(const char* s, size_type n) const noexcept;
+  int compare(const char* s) const noexcept;
+  template <std :: size_t AnotherCapacity> int compare(const fixedCapacityString<AnotherCapacity>& a) const noexcept;
+  std :: size_t hash() const noexcept;
+  void swap(fixedCapacityString& a);
+  private:
+  void terminate(size_type n) noexcept;
+  fixedCapacityVector<char, Capacity + 1u> Data;
+ };
+
+ int fixedCapacityStringCompare(const char* a, std :: size_t aLength, const char* b, std :: size_t bLength) noexcept;
+ //Same value as std :: hash <std :: string> from C++17, so a fixedCapacityString can look up std :: string keys; before C++17 eight bytes at a time through a multiply and rotate.
+ std :: size_t fixedCapacityStringHash(const char* s, std :: size_t n) noexcept;
+
+ template <std :: size_t Capacity> void swap(fixedCapacityString<Capacity>& a, fixedCapacityString<Capacity>& b);
+ template <std :: size_t Capacity> std :: ostream& operator << (std :: ostream& os, const fixedCapacityString<Capacity>& a);
+
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> bool operator == (const fixedCapacityString<Capacity>& a, const fixedCapacityString<AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> bool operator != (const fixedCapacityString<Capacity>& a, const fixedCapacityString<AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> bool operator < (const fixedCapacityString<Capacity>& a, const fixedCapacityString<AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> bool operator > (const fixedCapacityString<Capacity>& a, const fixedCapacityString<AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> bool operator <= (const fixedCapacityString<Capacity>& a, const fixedCapacityString<AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> bool operator >= (const fixedCapacityString<Capacity>& a, const fixedCapacityString<AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity> bool operator == (const fixedCapacityString<Capacity>& a, const char* b) noexcept;
+ template <std :: size_t Capacity> bool operator == (const char* a, const fixedCapacityString<Capacity>& b) noexcept;
+ template <std :: size_t Capacity> bool operator != (const fixedCapacityString<Capacity>& a, const char* b) noexcept;
+ template <std :: size_t Capacity> bool operator != (const char* a, const fixedCapacityString<Capacity>& b) noexcept;
+ template <std :: size_t Capacity> bool operator == (const fixedCapacityString<Capacity>& a, const std :: string& b) noexcept;
+ template <std :: size_t Capacity> bool operator == (const std :: string& a, const fixedCapacityString<Capacity>& b) noexcept;
+ template <std :: size_t Capacity> bool operator != (const fixedCapacityString<Capacity>& a, const std :: string& b) noexcept;
+ template <std :: size_t Capacity> bool operator != (const std :: string& a, const fixedCapacityString<Capacity>& b) noexcept;
+}
+
+namespace std
+{
+ template <std :: size_t Capacity> struct hash<shMath :: fixedCapacityString<Capacity> >
+ {
+  std :: size_t operator () (const shMath :: fixedCapacityString<Capacity>& a) const noexcept;
+ };
+
+ #ifdef __cpp_lib_format
+ template <std :: size_t Capacity> struct formatter<shMath :: fixedCapacityString<Capacity>, char> : formatter<std :: string_view, char>
+ {
+  template <class FormatContext> typename FormatContext :: iterator format(const shMath :: fixedCapacityString<Capacity>& a, FormatContext& context) const;
+ };
+ #endif
+}
+
+#if (__cplusplus < 201703)
+template <std :: size_t Capacity> constexpr std :: size_t shMath :: fixedCapacityString <Capacity> :: npos;
+#endif
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity> :: fixedCapacityString()
+: Data(1u, '\0')
+{
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity> :: fixedCapacityString(const char* s)
+: Data(1u, '\0')
+{
+ append(s, traits_type :: length(s));
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity> :: fixedCapacityString(const char* s, typename shMath :: fixedCapacityString <Capacity> :: size_type n)
+: Data(1u, '\0')
+{
+ append(s, n);
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity> :: fixedCapacityString(typename shMath :: fixedCapacityString <Capacity> :: size_type n, char c)
+: Data(1u, '\0')
+{
+ append(n, c);
+}
+
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> inline shMath :: fixedCapacityString <Capacity> :: fixedCapacityString(const shMath :: fixedCapacityString<AnotherCapacity>& a)
+: Data(1u, '\0')
+{
+ append(a.data(), a.size());
+}
+
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> inline shMath :: fixedCapacityString <Capacity> :: fixedCapacityString(const shMath :: fixedCapacityVector<char, AnotherCapacity>& a)
+: Data(1u, '\0')
+{
+ append(a.data(), a.size());
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity> :: fixedCapacityString(const std :: string& a)
+: Data(1u, '\0')
+{
+ append(a.data(), a.size());
+}
+
+#if (__cplusplus < 201703)
+#else
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity> :: fixedCapacityString(std :: string_view a)
+: Data(1u, '\0')
+{
+ append(a.data(), a.size());
+}
+#endif
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: operator = (const char* s)
+{
+ const size_type n = traits_type :: length(s);
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<char, Capacity + 1u>();
+ }
+ traits_type :: move(Data.data(), s, n); //s may point into this string.
+ terminate(n);
+ return *this;
+}
+
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: operator = (const shMath :: fixedCapacityString<AnotherCapacity>& a)
+{
+ if (a.size() > Capacity)
+ {
+  fixedCapacityVectorOverflow<char, Capacity + 1u>();
+ }
+ traits_type :: copy(Data.data(), a.data(), a.size());
+ terminate(a.size());
+ return *this;
+}
+
+template <std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacityString <Capacity> :: size_type shMath :: fixedCapacityString <Capacity> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacityString <Capacity> :: size_type shMath :: fixedCapacityString <Capacity> :: max_size() const noexcept
+{
+ return Capacity;
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: size_type shMath :: fixedCapacityString <Capacity> :: size() const noexcept
+{
+ return Data.size() - 1u;
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: size_type shMath :: fixedCapacityString <Capacity> :: length() const noexcept
+{
+ return size();
+}
+
+template <std :: size_t Capacity> inline bool shMath :: fixedCapacityString <Capacity> :: empty() const noexcept
+{
+ return (Data.size() == 1u);
+}
+
+template <std :: size_t Capacity> inline const char* shMath :: fixedCapacityString <Capacity> :: c_str() const noexcept
+{
+ return Data.data();
+}
+
+template <std :: size_t Capacity> inline char* shMath :: fixedCapacityString <Capacity> :: data() noexcept
+{
+ return Data.data();
+}
+
+template <std :: size_t Capacity> inline const char* shMath :: fixedCapacityString <Capacity> :: data() const noexcept
+{
+ return Data.data();
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: iterator shMath :: fixedCapacityString <Capacity> :: begin() noexcept
+{
+ return data();
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_iterator shMath :: fixedCapacityString <Capacity> :: begin() const noexcept
+{
+ return data();
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_iterator shMath :: fixedCapacityString <Capacity> :: cbegin() const noexcept
+{
+ return data();
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: iterator shMath :: fixedCapacityString <Capacity> :: end() noexcept
+{
+ return data() + size();
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_iterator shMath :: fixedCapacityString <Capacity> :: end() const noexcept
+{
+ return data() + size();
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_iterator shMath :: fixedCapacityString <Capacity> :: cend() const noexcept
+{
+ return data() + size();
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: reverse_iterator shMath :: fixedCapacityString <Capacity> :: rbegin() noexcept
+{
+ return reverse_iterator(end());
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_reverse_iterator shMath :: fixedCapacityString <Capacity> :: rbegin() const noexcept
+{
+ return const_reverse_iterator(end());
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: reverse_iterator shMath :: fixedCapacityString <Capacity> :: rend() noexcept
+{
+ return reverse_iterator(begin());
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_reverse_iterator shMath :: fixedCapacityString <Capacity> :: rend() const noexcept
+{
+ return const_reverse_iterator(begin());
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: reference shMath :: fixedCapacityString <Capacity> :: operator [] (typename shMath :: fixedCapacityString <Capacity> :: size_type n) noexcept
+{
+ return Data[n];
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_reference shMath :: fixedCapacityString <Capacity> :: operator [] (typename shMath :: fixedCapacityString <Capacity> :: size_type n) const noexcept
+{
+ return Data[n];
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: reference shMath :: fixedCapacityString <Capacity> :: at(typename shMath :: fixedCapacityString <Capacity> :: size_type n)
+{
+ if (n >= size())
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return Data[n];
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_reference shMath :: fixedCapacityString <Capacity> :: at(typename shMath :: fixedCapacityString <Capacity> :: size_type n) const
+{
+ if (n >= size())
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return Data[n];
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: reference shMath :: fixedCapacityString <Capacity> :: front() noexcept
+{
+ return Data[0u];
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_reference shMath :: fixedCapacityString <Capacity> :: front() const noexcept
+{
+ return Data[0u];
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: reference shMath :: fixedCapacityString <Capacity> :: back() noexcept
+{
+ return Data[size() - 1u];
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: const_reference shMath :: fixedCapacityString <Capacity> :: back() const noexcept
+{
+ return Data[size() - 1u];
+}
+
+#if (__cplusplus < 201703)
+#else
+template <std :: size_t Capacity> inline std :: string_view shMath :: fixedCapacityString <Capacity> :: view() const noexcept
+{
+ return std :: string_view(data(), size());
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity> :: operator std :: string_view() const noexcept
+{
+ return view();
+}
+#endif
+
+template <std :: size_t Capacity> inline std :: string shMath :: fixedCapacityString <Capacity> :: str() const
+{
+ return std :: string(data(), size());
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: append(const char* s, typename shMath :: fixedCapacityString <Capacity> :: size_type n)
+{
+ const size_type length = size();
+ if (n > Capacity - length)
+ {
+  fixedCapacityVectorOverflow<char, Capacity + 1u>();
+ }
+ traits_type :: copy(Data.data() + length, s, n); //Starts on the terminator; a piece of this string lies below it, so nothing overlaps.
+ terminate(length + n);
+ return *this;
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: append(const char* s)
+{
+ return append(s, traits_type :: length(s));
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: append(typename shMath :: fixedCapacityString <Capacity> :: size_type n, char c)
+{
+ const size_type length = size();
+ if (n > Capacity - length)
+ {
+  fixedCapacityVectorOverflow<char, Capacity + 1u>();
+ }
+ traits_type :: assign(Data.data() + length, n, c);
+ terminate(length + n);
+ return *this;
+}
+
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: append(const shMath :: fixedCapacityString<AnotherCapacity>& a)
+{
+ return append(a.data(), a.size());
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: append(const std :: string& a)
+{
+ return append(a.data(), a.size());
+}
+
+#if (__cplusplus < 201703)
+#else
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: append(std :: string_view a)
+{
+ return append(a.data(), a.size());
+}
+#endif
+
+template <std :: size_t Capacity> inline bool shMath :: fixedCapacityString <Capacity> :: try_append(const char* s, typename shMath :: fixedCapacityString <Capacity> :: size_type n) noexcept
+{
+ const size_type length = size();
+ const size_type fits = (n < Capacity - length) ? n : Capacity - length;
+ traits_type :: copy(Data.data() + length, s, fits);
+ terminate(length + fits);
+ if (fits != n)
+ {
+  fixedCapacityVectorRecordOverflow<char, Capacity + 1u>();
+  return false;
+ }
+ return true;
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: operator += (char c)
+{
+ push_back(c);
+ return *this;
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: operator += (const char* s)
+{
+ return append(s);
+}
+
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: operator += (const shMath :: fixedCapacityString<AnotherCapacity>& a)
+{
+ return append(a.data(), a.size());
+}
+
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: operator += (const std :: string& a)
+{
+ return append(a.data(), a.size());
+}
+
+#if (__cplusplus < 201703)
+#else
+template <std :: size_t Capacity> inline shMath :: fixedCapacityString <Capacity>& shMath :: fixedCapacityString <Capacity> :: operator += (std :: string_view a)
+{
+ return append(a.data(), a.size());
+}
+#endif
+
+template <std :: size_t Capacity> inline void shMath :: fixedCapacityString <Capacity> :: push_back(char c)
+{
+ const size_type length = size();
+ if (length == Capacity)
+ {
+  fixedCapacityVectorOverflow<char, Capacity + 1u>();
+ }
+ Data[length] = c;
+ terminate(length + 1u);
+}
+
+template <std :: size_t Capacity> inline void shMath :: fixedCapacityString <Capacity> :: pop_back() noexcept
+{
+ terminate(size() - 1u);
+}
+
+template <std :: size_t Capacity> inline void shMath :: fixedCapacityString <Capacity> :: resize(typename shMath :: fixedCapacityString <Capacity> :: size_type n, char c)
+{
+ const size_type length = size();
+ if (n > length)
+ {
+  append(n - length, c);
+ }
+ else
+ {
+  terminate(n);
+ }
+}
+
+template <std :: size_t Capacity> inline void shMath :: fixedCapacityString <Capacity> :: clear() noexcept
+{
+ terminate(0u);
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: size_type shMath :: fixedCapacityString <Capacity> :: find(char c, typename shMath :: fixedCapacityString <Capacity> :: size_type pos) const noexcept
+{
+ const size_type length = size();
+ if (pos >= length)
+ {
+  return npos;
+ }
+ const char* found = fixedCapacityVectorFind(data() + pos, data() + length, c);
+ return (found == data() + length) ? npos : static_cast<size_type>(found - data());
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: size_type shMath :: fixedCapacityString <Capacity> :: find(const char* s, typename shMath :: fixedCapacityString <Capacity> :: size_type pos, typename shMath :: fixedCapacityString <Capacity> :: size_type n) const noexcept
+{
+ const size_type length = size();
+ if ((pos > length) || (n > length - pos))
+ {
+  return npos;
+ }
+ if (n == 0u)
+ {
+  return pos;
+ }
+ const char* last = data() + length - n + 1u;
+ for(const char* first = data() + pos;;++first)
+ {
+  first = fixedCapacityVectorFind(first, last, *s); //Jumps to the next candidate with the vectorised search.
+  if (first == last)
+  {
+   return npos;
+  }
+  if (traits_type :: compare(first + 1, s + 1, n - 1u) == 0)
+  {
+   return static_cast<size_type>(first - data());
+  }
+ }
+}
+
+template <std :: size_t Capacity> inline typename shMath :: fixedCapacityString <Capacity> :: size_type shMath :: fixedCapacityString <Capacity> :: find(const char* s, typename shMath :: fixedCapacityString <Capacity> :: size_type pos) const noexcept
+{
+ return find(s, pos, traits_type :: length(s));
+}
+
+template <std :: size_t Capacity> inline bool shMath :: fixedCapacityString <Capacity> :: contains(char c) const noexcept
+{
+ return (find(c) != npos);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: fixedCapacityString <Capacity> :: contains(const char* s) const noexcept
+{
+ return (find(s) != npos);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: fixedCapacityString <Capacity> :: starts_with(const char* s) const noexcept
+{
+ const size_type n = traits_type :: length(s);
+ return (n <= size()) && (traits_type :: compare(data(), s, n) == 0);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: fixedCapacityString <Capacity> :: ends_with(const char* s) const noexcept
+{
+ const size_type n = traits_type :: length(s);
+ return (n <= size()) && (traits_type :: compare(data() + size() - n, s, n) == 0);
+}
+
+template <std :: size_t Capacity> inline int shMath :: fixedCapacityString <Capacity> :: compare(const char* s, typename shMath :: fixedCapacityString <Capacity> :: size_type n) const noexcept
+{
+ return fixedCapacityStringCompare(data(), size(), s, n);
+}
+
+template <std :: size_t Capacity> inline int shMath :: fixedCapacityString <Capacity> :: compare(const char* s) const noexcept
+{
+ return fixedCapacityStringCompare(data(), size(), s, traits_type :: length(s));
+}
+
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> inline int shMath :: fixedCapacityString <Capacity> :: compare(const shMath :: fixedCapacityString<AnotherCapacity>& a) const noexcept
+{
+ return fixedCapacityStringCompare(data(), size(), a.data(), a.size());
+}
+
+template <std :: size_t Capacity> inline std :: size_t shMath :: fixedCapacityString <Capacity> :: hash() const noexcept
+{
+ return fixedCapacityStringHash(data(), size());
+}
+
+template <std :: size_t Capacity> inline void shMath :: fixedCapacityString <Capacity> :: swap(shMath :: fixedCapacityString <Capacity>& a)
+{
+ Data.swap(a.Data);
+}
+
+template <std :: size_t Capacity> inline void shMath :: fixedCapacityString <Capacity> :: terminate(typename shMath :: fixedCapacityString <Capacity> :: size_type n) noexcept
+{
+ if (n + 1u > Data.size())
+ {
+  Data.commit(n + 1u - Data.size()); //The characters are already written in the spare capacity.
+ }
+ else
+ {
+  Data.resize_default_init(n + 1u);
+ }
+ Data[n] = '\0';
+}
+
+inline int shMath :: fixedCapacityStringCompare(const char* a, std :: size_t aLength, const char* b, std :: size_t bLength) noexcept
+{
+ const int result = std :: char_traits<char> :: compare(a, b, (aLength < bLength) ? aLength : bLength);
+ if (result != 0)
+ {
+  return result;
+ }
+ return (aLength < bLength) ? -1 : ((aLength > bLength) ? 1 : 0);
+}
+
+inline std :: size_t shMath :: fixedCapacityStringHash(const char* s, std :: size_t n) noexcept
+{
+ #if (__cplusplus < 201703)
+ const std :: uint64_t multiplier = 0x9E3779B97F4A7C15u;
+ std :: uint64_t result = n * multiplier;
+ for(;n >= 8u;n -= 8u, s += 8u)
+ {
+  std :: uint64_t word;
+  std :: memcpy(&word, s, 8u);
+  result = (result ^ word) * multiplier;
+  result ^= result >> 29;
+ }
+ std :: uint64_t tail = 0u;
+ std :: memcpy(&tail, s, n);
+ result = (result ^ tail) * multiplier;
+ return static_cast<std :: size_t>(result ^ (result >> 32));
+ #else
+ return std :: hash<std :: string_view>()(std :: string_view(s, n));
+ #endif
+}
+
+template <std :: size_t Capacity> inline void shMath :: swap(shMath :: fixedCapacityString<Capacity>& a, shMath :: fixedCapacityString<Capacity>& b)
+{
+ a.swap(b);
+}
+
+template <std :: size_t Capacity> inline std :: ostream& shMath :: operator << (std :: ostream& os, const shMath :: fixedCapacityString<Capacity>& a)
+{
+ #if (__cplusplus < 201703)
+ return os.write(a.data(), static_cast<std :: streamsize>(a.size()));
+ #else
+ return os << a.view(); //Honours width and fill like a std :: string.
+ #endif
+}
+
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> inline bool shMath :: operator == (const shMath :: fixedCapacityString<Capacity>& a, const shMath :: fixedCapacityString<AnotherCapacity>& b) noexcept
+{
+ return (a.size() == b.size()) && (std :: char_traits<char> :: compare(a.data(), b.data(), a.size()) == 0);
+}
+
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> inline bool shMath :: operator != (const shMath :: fixedCapacityString<Capacity>& a, const shMath :: fixedCapacityString<AnotherCapacity>& b) noexcept
+{
+ return !(a == b);
+}
+
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> inline bool shMath :: operator < (const shMath :: fixedCapacityString<Capacity>& a, const shMath :: fixedCapacityString<AnotherCapacity>& b) noexcept
+{
+ return (a.compare(b) < 0);
+}
+
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> inline bool shMath :: operator > (const shMath :: fixedCapacityString<Capacity>& a, const shMath :: fixedCapacityString<AnotherCapacity>& b) noexcept
+{
+ return (a.compare(b) > 0);
+}
+
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> inline bool shMath :: operator <= (const shMath :: fixedCapacityString<Capacity>& a, const shMath :: fixedCapacityString<AnotherCapacity>& b) noexcept
+{
+ return (a.compare(b) <= 0);
+}
+
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> inline bool shMath :: operator >= (const shMath :: fixedCapacityString<Capacity>& a, const shMath :: fixedCapacityString<AnotherCapacity>& b) noexcept
+{
+ return (a.compare(b) >= 0);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: operator == (const shMath :: fixedCapacityString<Capacity>& a, const char* b) noexcept
+{
+ return (a.compare(b) == 0);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: operator == (const char* a, const shMath :: fixedCapacityString<Capacity>& b) noexcept
+{
+ return (b.compare(a) == 0);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: operator != (const shMath :: fixedCapacityString<Capacity>& a, const char* b) noexcept
+{
+ return (a.compare(b) != 0);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: operator != (const char* a, const shMath :: fixedCapacityString<Capacity>& b) noexcept
+{
+ return (b.compare(a) != 0);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: operator == (const shMath :: fixedCapacityString<Capacity>& a, const std :: string& b) noexcept
+{
+ return (a.size() == b.size()) && (std :: char_traits<char> :: compare(a.data(), b.data(), a.size()) == 0);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: operator == (const std :: string& a, const shMath :: fixedCapacityString<Capacity>& b) noexcept
+{
+ return (b == a);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: operator != (const shMath :: fixedCapacityString<Capacity>& a, const std :: string& b) noexcept
+{
+ return !(a == b);
+}
+
+template <std :: size_t Capacity> inline bool shMath :: operator != (const std :: string& a, const shMath :: fixedCapacityString<Capacity>& b) noexcept
+{
+ return !(b == a);
+}
+
+template <std :: size_t Capacity> inline std :: size_t std :: hash <shMath :: fixedCapacityString<Capacity> > :: operator () (const shMath :: fixedCapacityString<Capacity>& a) const noexcept
+{
+ return a.hash();
+}
+
+#ifdef __cpp_lib_format
+template <std :: size_t Capacity> template <class FormatContext> inline typename FormatContext :: iterator std :: formatter <shMath :: fixedCapacityString<Capacity>, char> :: format(const shMath :: fixedCapacityString<Capacity>& a, FormatContext& context) const
+{
+ return formatter<std :: string_view, char> :: format(a.view(), context);
+}
+#endif
+#endif
+#endif
@@ -1,6 +1,11 @@
 #ifndef SH_MATH_FIXEDSIZEVECTOR
 #define SH_MATH_FIXEDSIZEVECTOR
 
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
 #include <iterator>
 #include <memory>
 #include <new>
@@ -9,30 +14,339 @@
 
 #if (__cplusplus < 201103)
 #else
+#include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <type_traits>
 #endif
 
+#if (__cplusplus < 202002)
+#else
+#include <bit>
+#include <ranges>
+#include <span>
+#endif
+
+//Integral searches use SSE2 or AVX2 when the target enables them; defining SH_MATH_NO_SIMD keeps them scalar.
+#if (__cplusplus < 201103) || defined(SH_MATH_NO_SIMD)
+#else
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SH_MATH_SIMD_AVX2
+#else
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SH_MATH_SIMD_SSE2
+#endif
+#endif
+#endif
+
+#ifndef SH_MATH_CONSTEXPR20
+#if (__cplusplus < 202002)
+#define SH_MATH_CONSTEXPR20
+#else
+#define SH_MATH_CONSTEXPR20 constexpr
+#endif
+#endif
+
+//Cache line size assumed by the over-aligned and cache line isolated containers.
+#ifndef SH_MATH_CACHE_LINE_SIZE
+#define SH_MATH_CACHE_LINE_SIZE 64
+#endif
+
+//Defining SH_MATH_NO_EXCEPTIONS turns every overflow or range error into std :: abort; it is implied when exceptions are disabled.
+#ifndef SH_MATH_NO_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#else
+#define SH_MATH_NO_EXCEPTIONS
+#endif
+#endif
+
+//Defining SH_MATH_FIXEDCAPACITYVECTOR_STATS makes every fixedCapacityVector <Type, Capacity> record its peak size, overflows and how often each power of two size is reached; the report goes to stderr at exit.
+#ifdef SH_MATH_FIXEDCAPACITYVECTOR_STATS
+#if (__cplusplus < 201103)
+#error SH_MATH_FIXEDCAPACITYVECTOR_STATS requires C++11.
+#endif
+#include <atomic>
+#include <typeinfo>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+#endif
+
+#ifdef SH_MATH_NO_EXCEPTIONS
+#define SH_MATH_TRY if (true)
+#define SH_MATH_CATCH_ALL if (false)
+#define SH_MATH_RETHROW
+#else
+#define SH_MATH_TRY try
+#define SH_MATH_CATCH_ALL catch(...)
+#define SH_MATH_RETHROW throw
+#endif
+
 namespace shMath
 {
- template <class Type, std :: size_t Capacity> class fixedCapacityVector
+ template <bool Condition, class IfTrue, class IfFalse> struct fixedCapacityVectorSelect
+ {
+  typedef IfTrue type;
+ };
+
+ template <class IfTrue, class IfFalse> struct fixedCapacityVectorSelect<false, IfTrue, IfFalse>
+ {
+  typedef IfFalse type;
+ };
+
+ #if (__cplusplus < 201103)
+ typedef unsigned char fixedCapacityVectorByteCount;
+ #else
+ //One byte counter. An unsigned char may alias any object, so every element store would force it to be reloaded and stored again; an enumeration of the same width does not alias the elements and stays in a register across append loops.
+ class fixedCapacityVectorByteCount
+ {
+  public:
+  fixedCapacityVectorByteCount() = default;
+  constexpr fixedCapacityVectorByteCount(std :: size_t n) noexcept;
+  constexpr operator std :: size_t() const noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorByteCount& operator ++ () noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorByteCount& operator -- () noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorByteCount operator ++ (int) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorByteCount operator -- (int) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorByteCount& operator += (std :: size_t n) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorByteCount& operator -= (std :: size_t n) noexcept;
+  private:
+  enum class value_type : unsigned char {};
+  value_type Value;
+ };
+ #endif
+
+ //Smallest unsigned type able to count up to Capacity.
+ template <std :: size_t Capacity> struct fixedCapacityVectorSizeType
+ {
+  typedef typename fixedCapacityVectorSelect<(Capacity <= UCHAR_MAX), fixedCapacityVectorByteCount,
+          typename fixedCapacityVectorSelect<(Capacity <= USHRT_MAX), unsigned short,
+          typename fixedCapacityVectorSelect<(Capacity <= UINT_MAX), unsigned int, std :: size_t> :: type> :: type> :: type type;
+ };
+
+ #if (__cplusplus < 201103)
+ inline void fixedCapacityVectorThrowBadAlloc();
+ inline void fixedCapacityVectorThrowOutOfRange();
+ template <class Type, std :: size_t Capacity> void fixedCapacityVectorOverflow();
+ #else
+ [[noreturn]] inline void fixedCapacityVectorThrowBadAlloc();
+ [[noreturn]] inline void fixedCapacityVectorThrowOutOfRange();
+ template <class Type, std :: size_t Capacity> [[noreturn]] void fixedCapacityVectorOverflow();
+ #endif
+ //Statistics hooks; they compile to nothing unless SH_MATH_FIXEDCAPACITYVECTOR_STATS is defined.
+ template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void fixedCapacityVectorRecordGrowth(std :: size_t from, std :: size_t to);
+ template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void fixedCapacityVectorRecordOverflow();
+ inline void fixedCapacityVectorStatsReport(std :: FILE* out);
+
+ #ifdef SH_MATH_FIXEDCAPACITYVECTOR_STATS
+ //Counters shared by every vector of one <Type, Capacity>; Reached[b] counts the growths that crossed from below 2^b to 2^b or more elements.
+ struct fixedCapacityVectorStatsRecord
+ {
+  fixedCapacityVectorStatsRecord(const char* typeName, std :: size_t elementSize, std :: size_t capacity) noexcept;
+  const char* TypeName;
+  std :: size_t ElementSize;
+  std :: size_t Capacity;
+  std :: atomic<std :: size_t> Peak;
+  std :: atomic<std :: size_t> Overflows;
+  std :: atomic<std :: size_t> Reached[sizeof(std :: size_t) * CHAR_BIT];
+  fixedCapacityVectorStatsRecord* Next;
+ };
+
+ //Lock free list of the records in use; it prints the report when destroyed at exit.
+ struct fixedCapacityVectorStatsRegistry
+ {
+  fixedCapacityVectorStatsRegistry() noexcept;
+  ~fixedCapacityVectorStatsRegistry();
+  static fixedCapacityVectorStatsRegistry& instance();
+  void report(std :: FILE* out) const;
+  std :: atomic<fixedCapacityVectorStatsRecord*> Head;
+ };
+
+ //Readable form of a typeid name, such as int for i under the Itanium ABI; falls back to the name as given.
+ inline const char* fixedCapacityVectorTypeName(const char* name) noexcept;
+
+ template <class Type, std :: size_t Capacity> fixedCapacityVectorStatsRecord& fixedCapacityVectorStats();
+ #endif
+ template <class InputIterator, class Type> SH_MATH_CONSTEXPR20 Type* fixedCapacityVectorUninitializedCopy(InputIterator first, InputIterator last, Type* result);
+ template <class Type> SH_MATH_CONSTEXPR20 void fixedCapacityVectorUninitializedFill(Type* first, Type* last, const Type& value);
+ template <class Type> SH_MATH_CONSTEXPR20 const Type* fixedCapacityVectorFind(const Type* first, const Type* last, const Type& value);
+ template <class Type> SH_MATH_CONSTEXPR20 std :: size_t fixedCapacityVectorCount(const Type* first, const Type* last, const Type& value);
+ template <class Type> SH_MATH_CONSTEXPR20 bool fixedCapacityVectorEqual(const Type* first, const Type* last, const Type* other);
+
+ #if (__cplusplus < 201103)
+ #else
+ template <class Type> const Type* fixedCapacityVectorFind(const Type* first, const Type* last, const Type& value, std :: integral_constant<bool, false>);
+ template <class Type> std :: size_t fixedCapacityVectorCount(const Type* first, const Type* last, const Type& value, std :: integral_constant<bool, false>);
+ template <class Type> bool fixedCapacityVectorEqual(const Type* first, const Type* last, const Type* other, std :: integral_constant<bool, false>);
+ template <class Type> bool fixedCapacityVectorEqual(const Type* first, const Type* last, const Type* other, std :: integral_constant<bool, true>) noexcept;
+
+ #if defined(SH_MATH_SIMD_AVX2) || defined(SH_MATH_SIMD_SSE2)
+ #ifdef SH_MATH_SIMD_AVX2
+ typedef __m256i fixedCapacityVectorSimdRegister;
+ #else
+ typedef __m128i fixedCapacityVectorSimdRegister;
+ #endif
+
+ //Lane-wise broadcast and equality for integral elements of the given width.
+ template <std :: size_t Width> struct fixedCapacityVectorSimdLanes;
+
+ template <> struct fixedCapacityVectorSimdLanes<1u>
+ {
+  typedef char lane_type;
+  static fixedCapacityVectorSimdRegister broadcast(lane_type value) noexcept;
+  static fixedCapacityVectorSimdRegister equal(fixedCapacityVectorSimdRegister a, fixedCapacityVectorSimdRegister b) noexcept;
+ };
+
+ template <> struct fixedCapacityVectorSimdLanes<2u>
+ {
+  typedef short lane_type;
+  static fixedCapacityVectorSimdRegister broadcast(lane_type value) noexcept;
+  static fixedCapacityVectorSimdRegister equal(fixedCapacityVectorSimdRegister a, fixedCapacityVectorSimdRegister b) noexcept;
+ };
+
+ template <> struct fixedCapacityVectorSimdLanes<4u>
+ {
+  typedef int lane_type;
+  static fixedCapacityVectorSimdRegister broadcast(lane_type value) noexcept;
+  static fixedCapacityVectorSimdRegister equal(fixedCapacityVectorSimdRegister a, fixedCapacityVectorSimdRegister b) noexcept;
+ };
+
+ template <> struct fixedCapacityVectorSimdLanes<8u>
+ {
+  typedef long long lane_type;
+  static fixedCapacityVectorSimdRegister broadcast(lane_type value) noexcept;
+  static fixedCapacityVectorSimdRegister equal(fixedCapacityVectorSimdRegister a, fixedCapacityVectorSimdRegister b) noexcept;
+ };
+
+ template <class Type> struct fixedCapacityVectorSimdEnabled : std :: integral_constant<bool, std :: is_integral<Type> :: value && ((sizeof(Type) == 1u) || (sizeof(Type) == 2u) || (sizeof(Type) == 4u) || (sizeof(Type) == 8u))>
+ {
+ };
+
+ fixedCapacityVectorSimdRegister fixedCapacityVectorSimdLoad(const void* address) noexcept;
+ unsigned int fixedCapacityVectorSimdMask(fixedCapacityVectorSimdRegister a) noexcept;
+ template <class Type> const Type* fixedCapacityVectorFind(const Type* first, const Type* last, const Type& value, std :: integral_constant<bool, true>) noexcept;
+ template <class Type> std :: size_t fixedCapacityVectorCount(const Type* first, const Type* last, const Type& value, std :: integral_constant<bool, true>) noexcept;
+ #else
+ template <class Type> struct fixedCapacityVectorSimdEnabled : std :: integral_constant<bool, false>
+ {
+ };
+ #endif
+
+ //Serialized form of a fixedCapacityVector of trivially copyable elements: this header, zero padding up to DataOffset, then Size packed elements.
+ //Everything is in the byte order of the writer, which ByteOrder records so that a reader of the other byte order rejects the data.
+ struct fixedCapacityVectorWireHeader
+ {
+  static constexpr std :: uint32_t magic = 0x56464853u; //"SHFV" as little endian bytes.
+  static constexpr std :: uint16_t version = 1u;
+  static constexpr std :: uint16_t byteOrder = 0x0102u;
+  std :: uint32_t Magic;
+  std :: uint16_t Version;
+  std :: uint16_t ByteOrder;
+  std :: uint32_t ElementSize;
+  std :: uint32_t DataOffset;
+  std :: uint64_t Size;
+ };
+
+ template <class Type> constexpr std :: size_t fixedCapacityVectorWireOffset() noexcept;
+ template <class Type> const unsigned char* fixedCapacityVectorWireElements(const void* buffer, std :: size_t bytes, std :: size_t capacity, std :: size_t& size) noexcept;
+ #endif
+
+ #if (__cplusplus < 202002)
+ #else
+ //Elements live in an inactive union member until constructed, so storage can be used in constant expressions.
+ template <class Type, std :: size_t Capacity> union fixedCapacityVectorData
+ {
+  constexpr fixedCapacityVectorData() noexcept;
+  constexpr ~fixedCapacityVectorData() requires (std :: is_trivially_destructible<Type> :: value) = default;
+  constexpr ~fixedCapacityVectorData() requires (!std :: is_trivially_destructible<Type> :: value);
+  unsigned char Empty;
+  Type Elements[Capacity];
+ };
+ #endif
+
+ #if (__cplusplus < 201103)
+ template <class Type, std :: size_t Capacity> class fixedCapacityVectorStorage
+ {
+  protected:
+  fixedCapacityVectorStorage();
+  char Data[sizeof(Type) * Capacity];
+  typename fixedCapacityVectorSizeType<Capacity> :: type Size;
+ };
+ #else
+ template <class Type, std :: size_t Capacity, bool TriviallyCopyable = std :: is_trivially_copyable<Type> :: value> class fixedCapacityVectorStorage
+ {
+  protected:
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorStorage() noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorStorage(const fixedCapacityVectorStorage& a) noexcept(std :: is_nothrow_copy_constructible<Type>{});
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorStorage(fixedCapacityVectorStorage&& a) noexcept(std :: is_nothrow_move_constructible<Type>{});
+  SH_MATH_CONSTEXPR20 ~fixedCapacityVectorStorage() noexcept(std :: is_nothrow_destructible<Type>{});
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorStorage& operator = (const fixedCapacityVectorStorage& a) noexcept(std :: is_nothrow_copy_constructible<Type>{} && std :: is_nothrow_copy_assignable<Type>{});
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorStorage& operator = (fixedCapacityVectorStorage&& a) noexcept(std :: is_nothrow_move_constructible<Type>{} && std :: is_nothrow_move_assignable<Type>{});
+  #if (__cplusplus < 202002)
+  typename std :: aligned_storage <sizeof(Type), alignof(Type)> :: type Data[Capacity];
+  #else
+  fixedCapacityVectorData<Type, Capacity> Data;
+  #endif
+  typename fixedCapacityVectorSizeType<Capacity> :: type Size;
+  private:
+  SH_MATH_CONSTEXPR20 Type* elements() noexcept;
+  SH_MATH_CONSTEXPR20 const Type* elements() const noexcept;
+  SH_MATH_CONSTEXPR20 void destroy(std :: size_t n, std :: integral_constant<bool, false>) noexcept(std :: is_nothrow_destructible<Type>{});
+  SH_MATH_CONSTEXPR20 void destroy(std :: size_t n, std :: integral_constant<bool, true>) noexcept;
+ };
+
+ //Trivially copyable elements leave all copy, move and destruction to the compiler, so the whole vector stays trivially copyable.
+ template <class Type, std :: size_t Capacity> class fixedCapacityVectorStorage<Type, Capacity, true>
+ {
+  protected:
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorStorage() noexcept;
+  #if (__cplusplus < 202002)
+  typename std :: aligned_storage <sizeof(Type), alignof(Type)> :: type Data[Capacity];
+  #else
+  fixedCapacityVectorData<Type, Capacity> Data;
+  #endif
+  typename fixedCapacityVectorSizeType<Capacity> :: type Size;
+ };
+ #endif
+
+ template <class Type, std :: size_t Capacity> class fixedCapacityVector : private fixedCapacityVectorStorage<Type, Capacity>
  {
+  template <class AnotherType, std :: size_t AnotherCapacity> friend class fixedCapacityVector;
   public:
   typedef Type* pointer;
   typedef Type& reference;
   typedef const Type* const_pointer;
   typedef const Type& const_reference;
+  typedef Type* iterator;
+  typedef const Type* const_iterator;
+  typedef std :: reverse_iterator<iterator> reverse_iterator;
+  typedef std :: reverse_iterator<const_iterator> const_reverse_iterator;
   typedef std :: size_t size_type;
+  typedef std :: ptrdiff_t difference_type;
   typedef Type value_type;
-  explicit fixedCapacityVector(size_type n);
-  fixedCapacityVector(size_type n, const value_type& value);
-  template <class InputIterator> fixedCapacityVector(InputIterator first, InputIterator last);
-  template <std :: size_t AnotherCapacity> fixedCapacityVector(const fixedCapacityVector<Type, AnotherCapacity>& a);
+  SH_MATH_CONSTEXPR20 explicit fixedCapacityVector(size_type n);
+  SH_MATH_CONSTEXPR20 fixedCapacityVector(size_type n, const value_type& value);
+  template <class InputIterator> SH_MATH_CONSTEXPR20 fixedCapacityVector(InputIterator first, InputIterator last);
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector(const fixedCapacityVector<Type, AnotherCapacity>& a);
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector& operator = (const fixedCapacityVector<Type, AnotherCapacity>& a);
   #if (__cplusplus < 201103)
   fixedCapacityVector();
   fixedCapacityVector(const fixedCapacityVector& a);
   ~fixedCapacityVector();
+  fixedCapacityVector& operator = (const fixedCapacityVector& a);
   size_type capacity() const;
+  pointer data();
+  const_pointer data() const;
+  iterator begin();
+  const_iterator begin() const;
+  iterator end();
+  const_iterator end() const;
+  reverse_iterator rbegin();
+  const_reverse_iterator rbegin() const;
+  reverse_iterator rend();
+  const_reverse_iterator rend() const;
   bool empty() const;
   size_type size() const;
   reference operator [] (size_type n);
@@ -43,552 +357,3257 @@ namespace shMath
   const_reference back() const;
   void clear();
   void pop_back();
+  pointer try_push_back(const value_type& val);
+  reference unchecked_push_back(const value_type& val);
   #else
   typedef Type&& rvalue_reference;
   typedef const Type&& const_rvalue_reference;
-  fixedCapacityVector() noexcept;
-  fixedCapacityVector(const fixedCapacityVector& a) noexcept(std :: is_nothrow_copy_constructible<Type>{});
-  fixedCapacityVector(std :: initializer_list<value_type> list);
-  template <std :: size_t AnotherCapacity> fixedCapacityVector(fixedCapacityVector<Type, AnotherCapacity>&& a);
-  fixedCapacityVector(fixedCapacityVector&& a) noexcept(std :: is_nothrow_move_constructible<Type>{});
-  ~fixedCapacityVector() noexcept(std :: is_nothrow_destructible<Type>{});
+  SH_MATH_CONSTEXPR20 fixedCapacityVector() noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVector(std :: initializer_list<value_type> list);
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector(fixedCapacityVector<Type, AnotherCapacity>&& a);
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector& operator = (fixedCapacityVector<Type, AnotherCapacity>&& a);
+  SH_MATH_CONSTEXPR20 fixedCapacityVector& operator = (std :: initializer_list<value_type> list);
   constexpr size_type capacity() const noexcept;
-  pointer data() noexcept;
-  const_pointer data() const noexcept;
-  size_type size() const noexcept;
-  reference operator [] (size_type n) noexcept;
-  const_reference operator [] (size_type n) const noexcept;
-  reference front() & noexcept;
-  const_reference front() const & noexcept;
-  rvalue_reference front() && noexcept;
-  const_rvalue_reference front() const && noexcept;
-  reference back() & noexcept;
-  const_reference back() const & noexcept;
-  rvalue_reference back() && noexcept;
-  const_rvalue_reference back() const && noexcept;
-  void clear() noexcept(std :: is_nothrow_destructible<Type>{});
-  void pop_back() noexcept(std :: is_nothrow_destructible<Type>{});
-  void push_back(rvalue_reference val);
+  SH_MATH_CONSTEXPR20 pointer data() noexcept;
+  SH_MATH_CONSTEXPR20 const_pointer data() const noexcept;
+  SH_MATH_CONSTEXPR20 iterator begin() noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator begin() const noexcept;
+  SH_MATH_CONSTEXPR20 iterator end() noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator end() const noexcept;
+  SH_MATH_CONSTEXPR20 reverse_iterator rbegin() noexcept;
+  SH_MATH_CONSTEXPR20 const_reverse_iterator rbegin() const noexcept;
+  SH_MATH_CONSTEXPR20 reverse_iterator rend() noexcept;
+  SH_MATH_CONSTEXPR20 const_reverse_iterator rend() const noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator cbegin() const noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator cend() const noexcept;
+  SH_MATH_CONSTEXPR20 const_reverse_iterator crbegin() const noexcept;
+  SH_MATH_CONSTEXPR20 const_reverse_iterator crend() const noexcept;
+  SH_MATH_CONSTEXPR20 size_type size() const noexcept;
+  SH_MATH_CONSTEXPR20 reference operator [] (size_type n) noexcept;
+  SH_MATH_CONSTEXPR20 const_reference operator [] (size_type n) const noexcept;
+  SH_MATH_CONSTEXPR20 reference front() & noexcept;
+  SH_MATH_CONSTEXPR20 const_reference front() const & noexcept;
+  SH_MATH_CONSTEXPR20 rvalue_reference front() && noexcept;
+  SH_MATH_CONSTEXPR20 const_rvalue_reference front() const && noexcept;
+  SH_MATH_CONSTEXPR20 reference back() & noexcept;
+  SH_MATH_CONSTEXPR20 const_reference back() const & noexcept;
+  SH_MATH_CONSTEXPR20 rvalue_reference back() && noexcept;
+  SH_MATH_CONSTEXPR20 const_rvalue_reference back() const && noexcept;
+  SH_MATH_CONSTEXPR20 void clear() noexcept(std :: is_nothrow_destructible<Type>{});
+  SH_MATH_CONSTEXPR20 void pop_back() noexcept(std :: is_nothrow_destructible<Type>{});
+  SH_MATH_CONSTEXPR20 void push_back(rvalue_reference val);
+  //try_ variants return nullptr instead of throwing when full; unchecked_ variants require size() < capacity().
+  SH_MATH_CONSTEXPR20 pointer try_push_back(const value_type& val) noexcept(std :: is_nothrow_copy_constructible<Type>{});
+  SH_MATH_CONSTEXPR20 pointer try_push_back(rvalue_reference val) noexcept(std :: is_nothrow_move_constructible<Type>{});
+  template <class ... Args> SH_MATH_CONSTEXPR20 pointer try_emplace_back(Args&& ... args) noexcept(std :: is_nothrow_constructible<Type, Args&& ...>{});
+  SH_MATH_CONSTEXPR20 reference unchecked_push_back(const value_type& val) noexcept(std :: is_nothrow_copy_constructible<Type>{});
+  SH_MATH_CONSTEXPR20 reference unchecked_push_back(rvalue_reference val) noexcept(std :: is_nothrow_move_constructible<Type>{});
+  template <class ... Args> SH_MATH_CONSTEXPR20 reference unchecked_emplace_back(Args&& ... args) noexcept(std :: is_nothrow_constructible<Type, Args&& ...>{});
+  SH_MATH_CONSTEXPR20 iterator insert(const_iterator pos, rvalue_reference val);
+  SH_MATH_CONSTEXPR20 iterator insert(const_iterator pos, std :: initializer_list<value_type> list);
+  template <class ... Args> SH_MATH_CONSTEXPR20 iterator emplace(const_iterator pos, Args&& ... args);
+  SH_MATH_CONSTEXPR20 void assign(std :: initializer_list<value_type> list);
+  //Serialization to the fixedCapacityVectorWireHeader layout for trivially copyable elements; it reports failure instead of throwing.
+  size_type serialized_size() const noexcept;
+  size_type serialize_to(void* buffer, size_type bytes) const noexcept;
+  bool deserialize_from(const void* buffer, size_type bytes) noexcept;
+  #if (__cplusplus < 202002)
+  #else
+  size_type serialize_to(std :: span<std :: byte> buffer) const noexcept;
+  bool deserialize_from(std :: span<const std :: byte> buffer) noexcept;
+  #endif
   #if (__cplusplus < 201703)
   bool empty() const noexcept;
   template <class ... Args> void emplace_back(Args&& ... args);
   #else
-  template <class ... Args> reference emplace_back(Args&& ... args);
   #if (__cplusplus < 202002)
   bool empty() const noexcept;
+  template <class ... Args> reference emplace_back(Args&& ... args);
   #else
   [[nodiscard]] constexpr bool empty() const noexcept;
   template <class ... Args> constexpr reference emplace_back(Args&& ... args);
+  template <class Range> constexpr void append_range(Range&& range);
   #endif
   #endif
   #endif
-  reference at(size_type n);
-  const_reference at(size_type n) const;
-  void push_back(const value_type& val);
+  SH_MATH_CONSTEXPR20 reference at(size_type n);
+  SH_MATH_CONSTEXPR20 const_reference at(size_type n) const;
+  SH_MATH_CONSTEXPR20 void push_back(const value_type& val);
+  SH_MATH_CONSTEXPR20 iterator insert(const_iterator pos, const value_type& val);
+  SH_MATH_CONSTEXPR20 iterator insert(const_iterator pos, size_type n, const value_type& val);
+  #if (__cplusplus < 201103)
+  template <class InputIterator> iterator insert(const_iterator pos, InputIterator first, InputIterator last);
+  template <class InputIterator> void assign(InputIterator first, InputIterator last);
+  #else
+  template <class InputIterator, class = typename std :: enable_if<!std :: is_integral<InputIterator> :: value> :: type> SH_MATH_CONSTEXPR20 iterator insert(const_iterator pos, InputIterator first, InputIterator last);
+  template <class InputIterator, class = typename std :: enable_if<!std :: is_integral<InputIterator> :: value> :: type> SH_MATH_CONSTEXPR20 void assign(InputIterator first, InputIterator last);
+  #endif
+  SH_MATH_CONSTEXPR20 iterator erase(const_iterator pos);
+  SH_MATH_CONSTEXPR20 iterator erase(const_iterator first, const_iterator last);
+  SH_MATH_CONSTEXPR20 void resize(size_type n);
+  SH_MATH_CONSTEXPR20 void resize(size_type n, const value_type& val);
+  SH_MATH_CONSTEXPR20 void resize_default_init(size_type n);
+  //Raw storage past the last element; after writing k elements there, commit(k) makes them part of the vector.
+  SH_MATH_CONSTEXPR20 pointer spare_capacity();
+  SH_MATH_CONSTEXPR20 void commit(size_type n);
+  //op(spare_capacity(), n) returns how many of the n elements it wrote; claiming more than n throws std :: out_of_range and commits nothing.
+  template <class Operation> SH_MATH_CONSTEXPR20 size_type write_into(size_type n, Operation op);
+  SH_MATH_CONSTEXPR20 void assign(size_type n, const value_type& val);
+  SH_MATH_CONSTEXPR20 void swap(fixedCapacityVector& a);
+  SH_MATH_CONSTEXPR20 iterator find(const value_type& val);
+  SH_MATH_CONSTEXPR20 const_iterator find(const value_type& val) const;
+  SH_MATH_CONSTEXPR20 size_type count(const value_type& val) const;
+  SH_MATH_CONSTEXPR20 bool contains(const value_type& val) const;
   private:
-  void fillN();
-  std :: size_t Size;
+  using fixedCapacityVectorStorage<Type, Capacity> :: Size;
+  using fixedCapacityVectorStorage<Type, Capacity> :: Data;
+  SH_MATH_CONSTEXPR20 pointer rawData();
+  SH_MATH_CONSTEXPR20 void fillN(size_type n);
+  SH_MATH_CONSTEXPR20 void truncate(size_type n);
+  SH_MATH_CONSTEXPR20 pointer insertFillN(size_type offset, size_type n, const value_type& val);
+  template <class ForwardIterator> SH_MATH_CONSTEXPR20 pointer insertCopyN(size_type offset, ForwardIterator first, ForwardIterator last, size_type n);
+  template <class InputIterator> SH_MATH_CONSTEXPR20 pointer insertRange(size_type offset, InputIterator first, InputIterator last, std :: input_iterator_tag);
+  template <class ForwardIterator> SH_MATH_CONSTEXPR20 pointer insertRange(size_type offset, ForwardIterator first, ForwardIterator last, std :: forward_iterator_tag);
+  template <class InputIterator> SH_MATH_CONSTEXPR20 void assignRange(InputIterator first, InputIterator last, std :: input_iterator_tag);
+  template <class ForwardIterator> SH_MATH_CONSTEXPR20 void assignRange(ForwardIterator first, ForwardIterator last, std :: forward_iterator_tag);
+  SH_MATH_CONSTEXPR20 void eraseN(size_type offset, size_type n);
   #if (__cplusplus < 201103)
-  char Data[sizeof(Type) * Capacity];
   #else
-  void fillN(std :: integral_constant<bool, false>, std :: integral_constant<bool, false>);
-  void fillN(std :: integral_constant<bool, false>, std :: integral_constant<bool, true>);
-  void fillN(std :: integral_constant<bool, true>, std :: integral_constant<bool, false>) noexcept;
-  void fillN(std :: integral_constant<bool, true>, std :: integral_constant<bool, true>) noexcept;
-  typename std :: aligned_storage <sizeof(Type), alignof(Type)> :: type Data[Capacity];
+  SH_MATH_CONSTEXPR20 pointer insertFillN(size_type offset, size_type n, const value_type& val, std :: integral_constant<bool, false>);
+  SH_MATH_CONSTEXPR20 pointer insertFillN(size_type offset, size_type n, const value_type& val, std :: integral_constant<bool, true>) noexcept;
+  template <class ForwardIterator> SH_MATH_CONSTEXPR20 pointer insertCopyN(size_type offset, ForwardIterator first, ForwardIterator last, size_type n, std :: integral_constant<bool, false>);
+  template <class ForwardIterator> SH_MATH_CONSTEXPR20 pointer insertCopyN(size_type offset, ForwardIterator first, ForwardIterator last, size_type n, std :: integral_constant<bool, true>);
+  SH_MATH_CONSTEXPR20 void eraseN(size_type offset, size_type n, std :: integral_constant<bool, false>);
+  SH_MATH_CONSTEXPR20 void eraseN(size_type offset, size_type n, std :: integral_constant<bool, true>) noexcept;
+  SH_MATH_CONSTEXPR20 void growDefaultInit(size_type n, std :: integral_constant<bool, false>);
+  SH_MATH_CONSTEXPR20 void growDefaultInit(size_type n, std :: integral_constant<bool, true>) noexcept;
+  void fillN(size_type n, std :: integral_constant<bool, false>, std :: integral_constant<bool, false>);
+  void fillN(size_type n, std :: integral_constant<bool, false>, std :: integral_constant<bool, true>);
+  void fillN(size_type n, std :: integral_constant<bool, true>, std :: integral_constant<bool, false>) noexcept;
+  void fillN(size_type n, std :: integral_constant<bool, true>, std :: integral_constant<bool, true>) noexcept;
+  SH_MATH_CONSTEXPR20 void copyN(const_pointer first, size_type n, std :: integral_constant<bool, false>);
+  SH_MATH_CONSTEXPR20 void copyN(const_pointer first, size_type n, std :: integral_constant<bool, true>) noexcept;
+  SH_MATH_CONSTEXPR20 void moveN(pointer first, size_type n, std :: integral_constant<bool, false>);
+  SH_MATH_CONSTEXPR20 void moveN(pointer first, size_type n, std :: integral_constant<bool, true>) noexcept;
+  SH_MATH_CONSTEXPR20 void truncate(size_type n, std :: integral_constant<bool, false>) noexcept(std :: is_nothrow_destructible<Type>{});
+  SH_MATH_CONSTEXPR20 void truncate(size_type n, std :: integral_constant<bool, true>) noexcept;
+  #endif
+ };
+
+ template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void swap(fixedCapacityVector<Type, Capacity>& a, fixedCapacityVector<Type, Capacity>& b);
+
+ #if (__cplusplus < 201103)
+ #else
+ //Read only fixedCapacityVector laid over serialized bytes, such as a memory mapped file, without copying them; the bytes must outlive the view.
+ template <class Type, std :: size_t Capacity> class fixedCapacityVectorView
+ {
+  static_assert(std :: is_trivially_copyable<Type> :: value, "fixedCapacityVectorView needs trivially copyable elements.");
+  public:
+  typedef const Type* const_pointer;
+  typedef const Type& const_reference;
+  typedef const Type* const_iterator;
+  typedef const_iterator iterator;
+  typedef std :: reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+  typedef std :: size_t size_type;
+  typedef std :: ptrdiff_t difference_type;
+  typedef Type value_type;
+  constexpr fixedCapacityVectorView() noexcept;
+  //Validates the header, the length and the alignment of the elements; on failure the view becomes empty and false is returned.
+  bool attach(const void* buffer, size_type bytes) noexcept;
+  #if (__cplusplus < 202002)
+  #else
+  bool attach(std :: span<const std :: byte> buffer) noexcept;
   #endif
+  constexpr size_type capacity() const noexcept;
+  const_pointer data() const noexcept;
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+  const_reverse_iterator rbegin() const noexcept;
+  const_reverse_iterator rend() const noexcept;
+  const_reference operator [] (size_type n) const noexcept;
+  const_reference at(size_type n) const;
+  const_reference front() const noexcept;
+  const_reference back() const noexcept;
+  const_iterator find(const value_type& val) const;
+  size_type count(const value_type& val) const;
+  bool contains(const value_type& val) const;
+  private:
+  const Type* Data;
+  size_type Size;
+ };
+ #endif
+ template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator == (const fixedCapacityVector<Type, Capacity>& a, const fixedCapacityVector<Type, AnotherCapacity>& b);
+ template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator != (const fixedCapacityVector<Type, Capacity>& a, const fixedCapacityVector<Type, AnotherCapacity>& b);
+ template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator < (const fixedCapacityVector<Type, Capacity>& a, const fixedCapacityVector<Type, AnotherCapacity>& b);
+ template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator > (const fixedCapacityVector<Type, Capacity>& a, const fixedCapacityVector<Type, AnotherCapacity>& b);
+ template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator <= (const fixedCapacityVector<Type, Capacity>& a, const fixedCapacityVector<Type, AnotherCapacity>& b);
+ template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator >= (const fixedCapacityVector<Type, Capacity>& a, const fixedCapacityVector<Type, AnotherCapacity>& b);
+
+ #if (__cplusplus < 201103)
+ #else
+ //fixedCapacityVector starting on an Alignment boundary, which is where data() lies, and padded to a multiple of Alignment so neighbours in an array never share a cache line.
+ //Heap allocated instances only get the alignment from C++17 aligned new onwards.
+ template <class Type, std :: size_t Capacity, std :: size_t Alignment = SH_MATH_CACHE_LINE_SIZE> class alignas(Alignment) alignedFixedCapacityVector : public fixedCapacityVector<Type, Capacity>
+ {
+  static_assert((Alignment & (Alignment - 1u)) == 0u, "Alignment of alignedFixedCapacityVector should be a power of two.");
+  static_assert(Alignment >= alignof(fixedCapacityVector<Type, Capacity>), "Alignment of alignedFixedCapacityVector should not be weaker than the one of fixedCapacityVector.");
+  public:
+  static constexpr std :: size_t alignment = Alignment;
+  using fixedCapacityVector<Type, Capacity> :: fixedCapacityVector;
+  using fixedCapacityVector<Type, Capacity> :: operator =;
+ };
+
+ //Population count and index of the lowest set bit of a word of the packed fixedCapacityVector <bool, Capacity>, through popcnt and tzcnt where the compiler exposes them; the word given to the latter should not be zero.
+ SH_MATH_CONSTEXPR20 unsigned int fixedCapacityVectorPopCount(std :: uint64_t word) noexcept;
+ SH_MATH_CONSTEXPR20 unsigned int fixedCapacityVectorTrailingZeros(std :: uint64_t word) noexcept;
+
+ //Proxy to one bit of a packed fixedCapacityVector <bool, Capacity>.
+ class fixedCapacityVectorBitReference
+ {
+  public:
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitReference(std :: uint64_t* word, std :: uint64_t mask) noexcept;
+  fixedCapacityVectorBitReference(const fixedCapacityVectorBitReference& a) = default;
+  SH_MATH_CONSTEXPR20 operator bool () const noexcept;
+  SH_MATH_CONSTEXPR20 bool operator ~ () const noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitReference& operator = (bool value) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitReference& operator = (const fixedCapacityVectorBitReference& a) noexcept;
+  SH_MATH_CONSTEXPR20 void flip() noexcept;
+  private:
+  std :: uint64_t* Word;
+  std :: uint64_t Mask;
+ };
+
+ SH_MATH_CONSTEXPR20 void swap(fixedCapacityVectorBitReference a, fixedCapacityVectorBitReference b) noexcept;
+
+ //Random access iterator over the bits; Reference is fixedCapacityVectorBitReference over mutable words and bool over const ones.
+ template <class Word, class Reference> class fixedCapacityVectorBitIterator
+ {
+  template <class AnotherWord, class AnotherReference> friend class fixedCapacityVectorBitIterator;
+  public:
+  typedef std :: random_access_iterator_tag iterator_category;
+  typedef bool value_type;
+  typedef std :: ptrdiff_t difference_type;
+  typedef void pointer;
+  typedef Reference reference;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator() noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator(Word* words, std :: size_t index) noexcept;
+  template <class AnotherWord, class AnotherReference, class = typename std :: enable_if<std :: is_convertible<AnotherWord*, Word*> :: value> :: type> SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator(const fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) noexcept;
+  SH_MATH_CONSTEXPR20 reference operator * () const noexcept;
+  SH_MATH_CONSTEXPR20 reference operator [] (difference_type n) const noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator& operator ++ () noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator operator ++ (int) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator& operator -- () noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator operator -- (int) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator& operator += (difference_type n) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator& operator -= (difference_type n) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator operator + (difference_type n) const noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator operator - (difference_type n) const noexcept;
+  template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 difference_type operator - (const fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept;
+  template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 bool operator == (const fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept;
+  template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 bool operator != (const fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept;
+  template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 bool operator < (const fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept;
+  template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 bool operator > (const fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept;
+  template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 bool operator <= (const fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept;
+  template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 bool operator >= (const fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept;
+  private:
+  SH_MATH_CONSTEXPR20 reference dereference(std :: size_t index, std :: integral_constant<bool, false>) const noexcept;
+  SH_MATH_CONSTEXPR20 reference dereference(std :: size_t index, std :: integral_constant<bool, true>) const noexcept;
+  Word* Words;
+  std :: size_t Index;
+ };
+
+ template <class Word, class Reference> SH_MATH_CONSTEXPR20 fixedCapacityVectorBitIterator<Word, Reference> operator + (typename fixedCapacityVectorBitIterator<Word, Reference> :: difference_type n, const fixedCapacityVectorBitIterator<Word, Reference>& a) noexcept;
+
+ //Flags packed 64 to a word instead of a byte each. Bits past size() are kept zero, so counting, searching, comparison and the bulk &, | and ^ run a word at a time.
+ //Elements are not addressable: operator [] and the iterators hand out fixedCapacityVectorBitReference proxies, and there is no data().
+ template <std :: size_t Capacity> class fixedCapacityVector<bool, Capacity>
+ {
+  template <class AnotherType, std :: size_t AnotherCapacity> friend class fixedCapacityVector;
+  public:
+  typedef std :: uint64_t word_type;
+  typedef fixedCapacityVectorBitReference reference;
+  typedef bool const_reference;
+  typedef fixedCapacityVectorBitIterator<word_type, reference> iterator;
+  typedef fixedCapacityVectorBitIterator<const word_type, bool> const_iterator;
+  typedef std :: reverse_iterator<iterator> reverse_iterator;
+  typedef std :: reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef std :: size_t size_type;
+  typedef std :: ptrdiff_t difference_type;
+  typedef bool value_type;
+  static constexpr size_type word_bits = 64u;
+  static constexpr size_type word_count = (Capacity + word_bits - 1u) / word_bits;
+  //Returned by find_first and find_next when no bit is set.
+  static constexpr size_type npos = static_cast<size_type>(-1);
+  SH_MATH_CONSTEXPR20 fixedCapacityVector() noexcept;
+  SH_MATH_CONSTEXPR20 explicit fixedCapacityVector(size_type n);
+  SH_MATH_CONSTEXPR20 fixedCapacityVector(size_type n, bool value);
+  template <class InputIterator, class = typename std :: enable_if<!std :: is_integral<InputIterator> :: value> :: type> SH_MATH_CONSTEXPR20 fixedCapacityVector(InputIterator first, InputIterator last);
+  SH_MATH_CONSTEXPR20 fixedCapacityVector(std :: initializer_list<bool> list);
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector(const fixedCapacityVector<bool, AnotherCapacity>& a);
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector& operator = (const fixedCapacityVector<bool, AnotherCapacity>& a);
+  SH_MATH_CONSTEXPR20 fixedCapacityVector& operator = (std :: initializer_list<bool> list);
+  constexpr size_type capacity() const noexcept;
+  SH_MATH_CONSTEXPR20 size_type size() const noexcept;
+  SH_MATH_CONSTEXPR20 bool empty() const noexcept;
+  //The packed words, bit i of the vector being bit i % 64 of word i / 64.
+  SH_MATH_CONSTEXPR20 const word_type* words() const noexcept;
+  SH_MATH_CONSTEXPR20 iterator begin() noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator begin() const noexcept;
+  SH_MATH_CONSTEXPR20 iterator end() noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator end() const noexcept;
+  SH_MATH_CONSTEXPR20 reverse_iterator rbegin() noexcept;
+  SH_MATH_CONSTEXPR20 const_reverse_iterator rbegin() const noexcept;
+  SH_MATH_CONSTEXPR20 reverse_iterator rend() noexcept;
+  SH_MATH_CONSTEXPR20 const_reverse_iterator rend() const noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator cbegin() const noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator cend() const noexcept;
+  SH_MATH_CONSTEXPR20 const_reverse_iterator crbegin() const noexcept;
+  SH_MATH_CONSTEXPR20 const_reverse_iterator crend() const noexcept;
+  SH_MATH_CONSTEXPR20 reference operator [] (size_type n) noexcept;
+  SH_MATH_CONSTEXPR20 const_reference operator [] (size_type n) const noexcept;
+  SH_MATH_CONSTEXPR20 reference at(size_type n);
+  SH_MATH_CONSTEXPR20 const_reference at(size_type n) const;
+  SH_MATH_CONSTEXPR20 reference front() noexcept;
+  SH_MATH_CONSTEXPR20 const_reference front() const noexcept;
+  SH_MATH_CONSTEXPR20 reference back() noexcept;
+  SH_MATH_CONSTEXPR20 const_reference back() const noexcept;
+  SH_MATH_CONSTEXPR20 void clear() noexcept;
+  SH_MATH_CONSTEXPR20 void pop_back() noexcept;
+  SH_MATH_CONSTEXPR20 void push_back(bool val);
+  //Returns false instead of throwing when full; unchecked_push_back requires size() < capacity().
+  SH_MATH_CONSTEXPR20 bool try_push_back(bool val) noexcept;
+  SH_MATH_CONSTEXPR20 void unchecked_push_back(bool val) noexcept;
+  SH_MATH_CONSTEXPR20 iterator insert(const_iterator pos, bool val);
+  SH_MATH_CONSTEXPR20 iterator insert(const_iterator pos, size_type n, bool val);
+  SH_MATH_CONSTEXPR20 iterator erase(const_iterator pos);
+  SH_MATH_CONSTEXPR20 iterator erase(const_iterator first, const_iterator last);
+  SH_MATH_CONSTEXPR20 void resize(size_type n, bool val = false);
+  SH_MATH_CONSTEXPR20 void assign(size_type n, bool val);
+  template <class InputIterator, class = typename std :: enable_if<!std :: is_integral<InputIterator> :: value> :: type> SH_MATH_CONSTEXPR20 void assign(InputIterator first, InputIterator last);
+  SH_MATH_CONSTEXPR20 void assign(std :: initializer_list<bool> list);
+  SH_MATH_CONSTEXPR20 void swap(fixedCapacityVector& a) noexcept;
+  SH_MATH_CONSTEXPR20 iterator find(bool val) noexcept;
+  SH_MATH_CONSTEXPR20 const_iterator find(bool val) const noexcept;
+  SH_MATH_CONSTEXPR20 size_type count(bool val) const noexcept;
+  SH_MATH_CONSTEXPR20 bool contains(bool val) const noexcept;
+  //Number of set bits.
+  SH_MATH_CONSTEXPR20 size_type count() const noexcept;
+  //all() holds for an empty vector, any() does not.
+  SH_MATH_CONSTEXPR20 bool all() const noexcept;
+  SH_MATH_CONSTEXPR20 bool any() const noexcept;
+  SH_MATH_CONSTEXPR20 bool none() const noexcept;
+  //Index of the first set bit, or of the first one after pos, npos when there is none.
+  SH_MATH_CONSTEXPR20 size_type find_first() const noexcept;
+  SH_MATH_CONSTEXPR20 size_type find_next(size_type pos) const noexcept;
+  SH_MATH_CONSTEXPR20 bool test(size_type n) const noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVector& set() noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVector& set(size_type n, bool val = true) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVector& reset() noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVector& reset(size_type n) noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVector& flip() noexcept;
+  SH_MATH_CONSTEXPR20 fixedCapacityVector& flip(size_type n) noexcept;
+  //Bulk operators need equal sizes and throw std :: out_of_range otherwise.
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector& operator &= (const fixedCapacityVector<bool, AnotherCapacity>& a);
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector& operator |= (const fixedCapacityVector<bool, AnotherCapacity>& a);
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 fixedCapacityVector& operator ^= (const fixedCapacityVector<bool, AnotherCapacity>& a);
+  SH_MATH_CONSTEXPR20 fixedCapacityVector operator ~ () const noexcept;
+  private:
+  static SH_MATH_CONSTEXPR20 word_type lowBits(size_type n) noexcept;
+  SH_MATH_CONSTEXPR20 size_type usedWords() const noexcept;
+  SH_MATH_CONSTEXPR20 size_type findBit(size_type from, word_type invert) const noexcept;
+  SH_MATH_CONSTEXPR20 void fillBits(size_type first, size_type last, bool val) noexcept;
+  SH_MATH_CONSTEXPR20 word_type extractBits(size_type first) const noexcept;
+  SH_MATH_CONSTEXPR20 void depositBits(size_type first, word_type bits, size_type n) noexcept;
+  SH_MATH_CONSTEXPR20 void grow(size_type n, bool val);
+  SH_MATH_CONSTEXPR20 void truncate(size_type n) noexcept;
+  template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 void checkSize(const fixedCapacityVector<bool, AnotherCapacity>& a) const;
+  word_type Words[word_count];
+  typename fixedCapacityVectorSizeType<Capacity> :: type Size;
  };
+
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator == (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator != (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator < (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator > (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator <= (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 bool operator >= (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, AnotherCapacity>& b) noexcept;
+ template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 fixedCapacityVector<bool, Capacity> operator & (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, Capacity>& b);
+ template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 fixedCapacityVector<bool, Capacity> operator | (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, Capacity>& b);
+ template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 fixedCapacityVector<bool, Capacity> operator ^ (const fixedCapacityVector<bool, Capacity>& a, const fixedCapacityVector<bool, Capacity>& b);
+ #endif
+}
+
+#if (__cplusplus < 201103) || (__cplusplus >= 201703)
+#else
+template <class Type, std :: size_t Capacity, std :: size_t Alignment> constexpr std :: size_t shMath :: alignedFixedCapacityVector <Type, Capacity, Alignment> :: alignment;
+template <std :: size_t Capacity> constexpr std :: size_t shMath :: fixedCapacityVector <bool, Capacity> :: word_bits;
+template <std :: size_t Capacity> constexpr std :: size_t shMath :: fixedCapacityVector <bool, Capacity> :: word_count;
+template <std :: size_t Capacity> constexpr std :: size_t shMath :: fixedCapacityVector <bool, Capacity> :: npos;
+#endif
+
+#if (__cplusplus < 201103)
+#else
+constexpr inline shMath :: fixedCapacityVectorByteCount :: fixedCapacityVectorByteCount(std :: size_t n) noexcept
+: Value(static_cast<value_type>(n))
+{
+}
+
+constexpr inline shMath :: fixedCapacityVectorByteCount :: operator std :: size_t() const noexcept
+{
+ return static_cast<std :: size_t>(Value);
 }
 
-template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
-: Size(n)
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorByteCount& shMath :: fixedCapacityVectorByteCount :: operator ++ () noexcept
 {
- if (Size > Capacity)
+ Value = static_cast<value_type>(static_cast<std :: size_t>(Value) + 1u);
+ return *this;
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorByteCount& shMath :: fixedCapacityVectorByteCount :: operator -- () noexcept
+{
+ Value = static_cast<value_type>(static_cast<std :: size_t>(Value) - 1u);
+ return *this;
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorByteCount shMath :: fixedCapacityVectorByteCount :: operator ++ (int) noexcept
+{
+ const fixedCapacityVectorByteCount old(*this);
+ ++*this;
+ return old;
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorByteCount shMath :: fixedCapacityVectorByteCount :: operator -- (int) noexcept
+{
+ const fixedCapacityVectorByteCount old(*this);
+ --*this;
+ return old;
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorByteCount& shMath :: fixedCapacityVectorByteCount :: operator += (std :: size_t n) noexcept
+{
+ Value = static_cast<value_type>(static_cast<std :: size_t>(Value) + n);
+ return *this;
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorByteCount& shMath :: fixedCapacityVectorByteCount :: operator -= (std :: size_t n) noexcept
+{
+ Value = static_cast<value_type>(static_cast<std :: size_t>(Value) - n);
+ return *this;
+}
+#endif
+
+inline void shMath :: fixedCapacityVectorThrowBadAlloc()
+{
+ #ifdef SH_MATH_NO_EXCEPTIONS
+ std :: abort();
+ #else
+ throw std :: bad_alloc();
+ #endif
+}
+
+inline void shMath :: fixedCapacityVectorThrowOutOfRange()
+{
+ #ifdef SH_MATH_NO_EXCEPTIONS
+ std :: abort();
+ #else
+ throw std :: out_of_range("Index out of range.");
+ #endif
+}
+
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVectorOverflow()
+{
+ fixedCapacityVectorRecordOverflow<Type, Capacity>();
+ fixedCapacityVectorThrowBadAlloc();
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVectorRecordGrowth(std :: size_t from, std :: size_t to)
+{
+ #ifdef SH_MATH_FIXEDCAPACITYVECTOR_STATS
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
  {
-  throw std :: bad_alloc();
+  return;
  }
- #if (__cplusplus < 201103)
- fillN();
+ #endif
+ if (to <= from)
+ {
+  return;
+ }
+ fixedCapacityVectorStatsRecord& record = fixedCapacityVectorStats<Type, Capacity>();
+ std :: size_t peak = record.Peak.load(std :: memory_order_relaxed);
+ while ((peak < to) && !record.Peak.compare_exchange_weak(peak, to, std :: memory_order_relaxed))
+ {
+ }
+ const std :: size_t buckets = sizeof(std :: size_t) * CHAR_BIT;
+ std :: size_t bucket = 0u;
+ for(;(bucket != buckets) && ((from >> bucket) != 0u);++bucket);
+ for(;(bucket != buckets) && ((static_cast<std :: size_t>(1u) << bucket) <= to);++bucket) record.Reached[bucket].fetch_add(1u, std :: memory_order_relaxed);
  #else
- fillN(std :: is_nothrow_default_constructible<Type>{}, std :: is_nothrow_destructible<Type>{});
+ static_cast<void>(from);
+ static_cast<void>(to);
  #endif
 }
 
-template <class Type, std :: size_t Capacity> shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& value)
-: Size(n)
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVectorRecordOverflow()
 {
- Type* const first = reinterpret_cast<Type*>(Data);
- Type* const last = first + n;
- if (n > Capacity)
+ #ifdef SH_MATH_FIXEDCAPACITYVECTOR_STATS
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
  {
-  throw std :: bad_alloc();
+  return;
  }
- std :: uninitialized_fill(first, last, value);
+ #endif
+ fixedCapacityVectorStats<Type, Capacity>().Overflows.fetch_add(1u, std :: memory_order_relaxed);
+ #endif
+}
+
+inline void shMath :: fixedCapacityVectorStatsReport(std :: FILE* out)
+{
+ #ifdef SH_MATH_FIXEDCAPACITYVECTOR_STATS
+ fixedCapacityVectorStatsRegistry :: instance().report(out);
+ #else
+ static_cast<void>(out);
+ #endif
 }
 
-template <class Type, std :: size_t Capacity> template <class InputIterator> shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(InputIterator first, InputIterator last)
-: Size(reinterpret_cast<std :: size_t>(std :: distance(first, last)))
+#ifdef SH_MATH_FIXEDCAPACITYVECTOR_STATS
+inline shMath :: fixedCapacityVectorStatsRecord :: fixedCapacityVectorStatsRecord(const char* typeName, std :: size_t elementSize, std :: size_t capacity) noexcept
+: TypeName(typeName), ElementSize(elementSize), Capacity(capacity), Peak(0u), Overflows(0u), Reached(), Next(nullptr)
 {
- Type* const dataFirst = reinterpret_cast<Type*>(Data);
- if (Size > Capacity)
+ std :: atomic<fixedCapacityVectorStatsRecord*>& head = fixedCapacityVectorStatsRegistry :: instance().Head;
+ Next = head.load(std :: memory_order_relaxed);
+ while (!head.compare_exchange_weak(Next, this, std :: memory_order_release, std :: memory_order_relaxed))
  {
-  throw std :: bad_alloc();
  }
- std :: uninitialized_copy(first, last, dataFirst);
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector()
-#else
-template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector() noexcept
-#endif
-: Size(0u)
+inline shMath :: fixedCapacityVectorStatsRegistry :: fixedCapacityVectorStatsRegistry() noexcept
+: Head(nullptr)
+{
+}
+
+inline shMath :: fixedCapacityVectorStatsRegistry :: ~fixedCapacityVectorStatsRegistry()
+{
+ report(stderr);
+}
+
+inline shMath :: fixedCapacityVectorStatsRegistry& shMath :: fixedCapacityVectorStatsRegistry :: instance()
+{
+ static fixedCapacityVectorStatsRegistry registry;
+ return registry;
+}
+
+inline void shMath :: fixedCapacityVectorStatsRegistry :: report(std :: FILE* out) const
+{
+ for (const fixedCapacityVectorStatsRecord* record = Head.load(std :: memory_order_acquire);record != nullptr;record = record->Next)
+ {
+  std :: fprintf(out, "fixedCapacityVector<%s, %zu> (%zu byte elements): peak %zu, overflows %zu, reached",
+                 record->TypeName, record->Capacity, record->ElementSize, record->Peak.load(std :: memory_order_relaxed), record->Overflows.load(std :: memory_order_relaxed));
+  for(std :: size_t bucket = 0u;(bucket != sizeof(std :: size_t) * CHAR_BIT) && ((static_cast<std :: size_t>(1u) << bucket) <= record->Capacity);++bucket)
+  {
+   std :: fprintf(out, " %zu+:%zu", static_cast<std :: size_t>(1u) << bucket, record->Reached[bucket].load(std :: memory_order_relaxed));
+  }
+  std :: fputc('\n', out);
+ }
+}
+
+inline const char* shMath :: fixedCapacityVectorTypeName(const char* name) noexcept
+{
+ #ifdef __GNUG__
+ int status = -1;
+ const char* const result = abi :: __cxa_demangle(name, nullptr, nullptr, &status); //Never freed, as the record keeping it lives until exit.
+ return (status == 0) ? result : name;
+ #else
+ return name;
+ #endif
+}
+
+//Records are trivially destructible, so the report printed at exit can still read every one of them.
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVectorStatsRecord& shMath :: fixedCapacityVectorStats()
+{
+ #if defined(__GXX_RTTI) || defined(_CPPRTTI) || defined(__cpp_rtti)
+ static fixedCapacityVectorStatsRecord record(fixedCapacityVectorTypeName(typeid(Type).name()), sizeof(Type), Capacity);
+ #else
+ static fixedCapacityVectorStatsRecord record("?", sizeof(Type), Capacity);
+ #endif
+ return record;
+}
+#endif
+
+template <class InputIterator, class Type> SH_MATH_CONSTEXPR20 inline Type* shMath :: fixedCapacityVectorUninitializedCopy(InputIterator first, InputIterator last, Type* result)
+{
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  Type* current = result;
+  SH_MATH_TRY
+  {
+   for(;first != last;++first,++current) std :: construct_at(current, *first);
+  }
+  SH_MATH_CATCH_ALL
+  {
+   std :: destroy(result, current);
+   SH_MATH_RETHROW;
+  }
+  return current;
+ }
+ #endif
+ return std :: uninitialized_copy(first, last, result);
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVectorUninitializedFill(Type* first, Type* last, const Type& value)
+{
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  Type* current = first;
+  SH_MATH_TRY
+  {
+   for(;current != last;++current) std :: construct_at(current, value);
+  }
+  SH_MATH_CATCH_ALL
+  {
+   std :: destroy(first, current);
+   SH_MATH_RETHROW;
+  }
+  return;
+ }
+ #endif
+ std :: uninitialized_fill(first, last, value);
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline const Type* shMath :: fixedCapacityVectorFind(const Type* first, const Type* last, const Type& value)
+{
+ #if (__cplusplus < 201103)
+ return std :: find(first, last, value);
+ #else
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  return std :: find(first, last, value);
+ }
+ #endif
+ return fixedCapacityVectorFind(first, last, value, fixedCapacityVectorSimdEnabled<Type>{});
+ #endif
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline std :: size_t shMath :: fixedCapacityVectorCount(const Type* first, const Type* last, const Type& value)
+{
+ #if (__cplusplus < 201103)
+ return static_cast<std :: size_t>(std :: count(first, last, value));
+ #else
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  return static_cast<std :: size_t>(std :: count(first, last, value));
+ }
+ #endif
+ return fixedCapacityVectorCount(first, last, value, fixedCapacityVectorSimdEnabled<Type>{});
+ #endif
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVectorEqual(const Type* first, const Type* last, const Type* other)
+{
+ #if (__cplusplus < 201103)
+ return std :: equal(first, last, other);
+ #else
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  return std :: equal(first, last, other);
+ }
+ #endif
+ return fixedCapacityVectorEqual(first, last, other, std :: is_integral<Type>{});
+ #endif
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type> inline const Type* shMath :: fixedCapacityVectorFind(const Type* first, const Type* last, const Type& value, std :: integral_constant<bool, false>)
+{
+ return std :: find(first, last, value);
+}
+
+template <class Type> inline std :: size_t shMath :: fixedCapacityVectorCount(const Type* first, const Type* last, const Type& value, std :: integral_constant<bool, false>)
+{
+ return static_cast<std :: size_t>(std :: count(first, last, value));
+}
+
+template <class Type> inline bool shMath :: fixedCapacityVectorEqual(const Type* first, const Type* last, const Type* other, std :: integral_constant<bool, false>)
+{
+ return std :: equal(first, last, other);
+}
+
+template <class Type> inline bool shMath :: fixedCapacityVectorEqual(const Type* first, const Type* last, const Type* other, std :: integral_constant<bool, true>) noexcept
+{
+ return (std :: memcmp(first, other, static_cast<std :: size_t>(last - first) * sizeof(Type)) == 0); //Integral types have no padding, so bitwise equality is value equality.
+}
+
+#if defined(SH_MATH_SIMD_AVX2) || defined(SH_MATH_SIMD_SSE2)
+#ifdef SH_MATH_SIMD_AVX2
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<1u> :: broadcast(char value) noexcept
+{
+ return _mm256_set1_epi8(value);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<1u> :: equal(shMath :: fixedCapacityVectorSimdRegister a, shMath :: fixedCapacityVectorSimdRegister b) noexcept
+{
+ return _mm256_cmpeq_epi8(a, b);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<2u> :: broadcast(short value) noexcept
+{
+ return _mm256_set1_epi16(value);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<2u> :: equal(shMath :: fixedCapacityVectorSimdRegister a, shMath :: fixedCapacityVectorSimdRegister b) noexcept
+{
+ return _mm256_cmpeq_epi16(a, b);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<4u> :: broadcast(int value) noexcept
+{
+ return _mm256_set1_epi32(value);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<4u> :: equal(shMath :: fixedCapacityVectorSimdRegister a, shMath :: fixedCapacityVectorSimdRegister b) noexcept
+{
+ return _mm256_cmpeq_epi32(a, b);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<8u> :: broadcast(long long value) noexcept
+{
+ return _mm256_set1_epi64x(value);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<8u> :: equal(shMath :: fixedCapacityVectorSimdRegister a, shMath :: fixedCapacityVectorSimdRegister b) noexcept
+{
+ return _mm256_cmpeq_epi64(a, b);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLoad(const void* address) noexcept
+{
+ return _mm256_loadu_si256(static_cast<const __m256i*>(address));
+}
+
+inline unsigned int shMath :: fixedCapacityVectorSimdMask(shMath :: fixedCapacityVectorSimdRegister a) noexcept
+{
+ return static_cast<unsigned int>(_mm256_movemask_epi8(a));
+}
+#else
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<1u> :: broadcast(char value) noexcept
+{
+ return _mm_set1_epi8(value);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<1u> :: equal(shMath :: fixedCapacityVectorSimdRegister a, shMath :: fixedCapacityVectorSimdRegister b) noexcept
+{
+ return _mm_cmpeq_epi8(a, b);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<2u> :: broadcast(short value) noexcept
+{
+ return _mm_set1_epi16(value);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<2u> :: equal(shMath :: fixedCapacityVectorSimdRegister a, shMath :: fixedCapacityVectorSimdRegister b) noexcept
+{
+ return _mm_cmpeq_epi16(a, b);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<4u> :: broadcast(int value) noexcept
+{
+ return _mm_set1_epi32(value);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<4u> :: equal(shMath :: fixedCapacityVectorSimdRegister a, shMath :: fixedCapacityVectorSimdRegister b) noexcept
+{
+ return _mm_cmpeq_epi32(a, b);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<8u> :: broadcast(long long value) noexcept
+{
+ return _mm_set1_epi64x(value);
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLanes<8u> :: equal(shMath :: fixedCapacityVectorSimdRegister a, shMath :: fixedCapacityVectorSimdRegister b) noexcept
+{
+ const __m128i halves = _mm_cmpeq_epi32(a, b); //SSE2 has no 64-bit compare, so both 32-bit halves have to match.
+ return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+inline shMath :: fixedCapacityVectorSimdRegister shMath :: fixedCapacityVectorSimdLoad(const void* address) noexcept
+{
+ return _mm_loadu_si128(static_cast<const __m128i*>(address));
+}
+
+inline unsigned int shMath :: fixedCapacityVectorSimdMask(shMath :: fixedCapacityVectorSimdRegister a) noexcept
+{
+ return static_cast<unsigned int>(_mm_movemask_epi8(a));
+}
+#endif
+
+template <class Type> inline const Type* shMath :: fixedCapacityVectorFind(const Type* first, const Type* last, const Type& value, std :: integral_constant<bool, true>) noexcept
+{
+ typedef fixedCapacityVectorSimdLanes<sizeof(Type)> Lanes;
+ const std :: ptrdiff_t step = sizeof(fixedCapacityVectorSimdRegister) / sizeof(Type);
+ typename Lanes :: lane_type lane;
+ std :: memcpy(&lane, &value, sizeof(Type));
+ const fixedCapacityVectorSimdRegister needle = Lanes :: broadcast(lane);
+ for(;(last - first) >= step;first += step)
+ {
+  if (fixedCapacityVectorSimdMask(Lanes :: equal(fixedCapacityVectorSimdLoad(first), needle)) != 0u) break; //The match is inside this block.
+ }
+ return std :: find(first, last, value);
+}
+
+template <class Type> inline std :: size_t shMath :: fixedCapacityVectorCount(const Type* first, const Type* last, const Type& value, std :: integral_constant<bool, true>) noexcept
+{
+ typedef fixedCapacityVectorSimdLanes<sizeof(Type)> Lanes;
+ const std :: ptrdiff_t step = sizeof(fixedCapacityVectorSimdRegister) / sizeof(Type);
+ typename Lanes :: lane_type lane;
+ std :: memcpy(&lane, &value, sizeof(Type));
+ const fixedCapacityVectorSimdRegister needle = Lanes :: broadcast(lane);
+ std :: size_t matchingBytes = 0u;
+ for(;(last - first) >= step;first += step)
+ {
+  for(unsigned int mask = fixedCapacityVectorSimdMask(Lanes :: equal(fixedCapacityVectorSimdLoad(first), needle));mask != 0u;mask &= mask - 1u) ++matchingBytes;
+ }
+ return matchingBytes / sizeof(Type) + static_cast<std :: size_t>(std :: count(first, last, value));
+}
+#endif
+#endif
+
+#if (__cplusplus < 202002)
+#else
+template <class Type, std :: size_t Capacity> constexpr inline shMath :: fixedCapacityVectorData <Type, Capacity> :: fixedCapacityVectorData() noexcept
+: Empty()
+{
+}
+
+template <class Type, std :: size_t Capacity> constexpr inline shMath :: fixedCapacityVectorData <Type, Capacity> :: ~fixedCapacityVectorData() requires (!std :: is_trivially_destructible<Type> :: value)
+{
+}
+#endif
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVectorStorage <Type, Capacity> :: fixedCapacityVectorStorage()
+: Size(0u)
+{
+}
+#else
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: fixedCapacityVectorStorage() noexcept
+: Size(0u)
+{
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: fixedCapacityVectorStorage(const shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable>& a) noexcept(std :: is_nothrow_copy_constructible<Type>{})
+: Size(0u)
+{
+ fixedCapacityVectorUninitializedCopy(a.elements(), a.elements() + a.Size, elements());
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, a.Size);
+ Size = a.Size;
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: fixedCapacityVectorStorage(shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable>&& a) noexcept(std :: is_nothrow_move_constructible<Type>{})
+: Size(0u)
+{
+ fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(a.elements()), std :: make_move_iterator(a.elements() + a.Size), elements());
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, a.Size);
+ Size = a.Size;
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: ~fixedCapacityVectorStorage() noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ destroy(0u, std :: is_trivially_destructible<Type>{});
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable>& shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: operator = (const shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable>& a) noexcept(std :: is_nothrow_copy_constructible<Type>{} && std :: is_nothrow_copy_assignable<Type>{})
+{
+ if (this != &a)
+ {
+  if (a.Size < Size)
+  {
+   std :: copy(a.elements(), a.elements() + a.Size, elements());
+   destroy(a.Size, std :: is_trivially_destructible<Type>{});
+  }
+  else
+  {
+   std :: copy(a.elements(), a.elements() + Size, elements());
+   fixedCapacityVectorUninitializedCopy(a.elements() + Size, a.elements() + a.Size, elements() + Size);
+   fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, a.Size);
+   Size = a.Size;
+  }
+ }
+ return *this;
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable>& shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: operator = (shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable>&& a) noexcept(std :: is_nothrow_move_constructible<Type>{} && std :: is_nothrow_move_assignable<Type>{})
+{
+ if (this != &a)
+ {
+  if (a.Size < Size)
+  {
+   std :: move(a.elements(), a.elements() + a.Size, elements());
+   destroy(a.Size, std :: is_trivially_destructible<Type>{});
+  }
+  else
+  {
+   std :: move(a.elements(), a.elements() + Size, elements());
+   fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(a.elements() + Size), std :: make_move_iterator(a.elements() + a.Size), elements() + Size);
+   fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, a.Size);
+   Size = a.Size;
+  }
+ }
+ return *this;
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 inline Type* shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: elements() noexcept
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<Type*>(Data);
+ #else
+ #if (__cplusplus < 202002)
+ return std :: launder(reinterpret_cast<Type*>(Data));
+ #else
+ return Data.Elements;
+ #endif
+ #endif
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 inline const Type* shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: elements() const noexcept
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<const Type*>(Data);
+ #else
+ #if (__cplusplus < 202002)
+ return std :: launder(reinterpret_cast<const Type*>(Data));
+ #else
+ return Data.Elements;
+ #endif
+ #endif
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: destroy(std :: size_t n, std :: integral_constant<bool, false>) noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ for(;Size != n;--Size) (elements() + Size - 1u)->~Type();
+}
+
+template <class Type, std :: size_t Capacity, bool TriviallyCopyable> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVectorStorage <Type, Capacity, TriviallyCopyable> :: destroy(std :: size_t n, std :: integral_constant<bool, true>) noexcept
+{
+ Size = n;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorStorage <Type, Capacity, true> :: fixedCapacityVectorStorage() noexcept
+: Size(0u)
+{
+ #if (__cplusplus < 202002)
+ #else
+ if constexpr (std :: is_trivially_default_constructible<Type> :: value)
+ {
+  if (std :: is_constant_evaluated())
+  {
+   std :: construct_at(&Data.Elements); //A constexpr object must not leave any element uninitialized.
+  }
+ }
+ #endif
+}
+#endif
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ #if (__cplusplus < 201103)
+ fillN(n);
+ #else
+ #if (__cplusplus < 202002)
+ fillN(n, std :: is_nothrow_default_constructible<Type>{}, std :: is_nothrow_destructible<Type>{});
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  fillN(n);
+ }
+ else
+ {
+  fillN(n, std :: is_nothrow_default_constructible<Type>{}, std :: is_nothrow_destructible<Type>{});
+ }
+ #endif
+ #endif
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& value)
+{
+ Type* const first = rawData();
+ Type* const last = first + n;
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ fixedCapacityVectorUninitializedFill(first, last, value);
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+ Size = n;
+}
+
+template <class Type, std :: size_t Capacity> template <class InputIterator> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(InputIterator first, InputIterator last)
+{
+ Type* const dataFirst = rawData();
+ const size_type n = static_cast<size_type>(std :: distance(first, last));
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ fixedCapacityVectorUninitializedCopy(first, last, dataFirst);
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+ Size = n;
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector() noexcept
+#endif
+{
+}
+
+template <class Type, std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVector<Type, Capacity> :: fixedCapacityVector(const fixedCapacityVector<Type, AnotherCapacity>& a)
+{
+ if (a.Size > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ #if (__cplusplus < 201103)
+ fixedCapacityVectorUninitializedCopy(a.data(), a.data() + a.Size, rawData());
+ #else
+ copyN(a.data(), a.Size, std :: is_trivially_copyable<Type>{});
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, a.Size);
+ Size = a.Size;
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(const shMath :: fixedCapacityVector<Type, Capacity>& a)
+{
+ fixedCapacityVectorUninitializedCopy(a.data(), a.data() + a.Size, rawData());
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, a.Size);
+ Size = a.Size;
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(shMath :: fixedCapacityVector<Type, AnotherCapacity>&& a)
+{
+ if (a.Size > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ moveN(a.data(), a.Size, std :: is_trivially_copyable<Type>{});
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, a.Size);
+ Size = a.Size;
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(std :: initializer_list<typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> list)
+{
+ Type* const dataFirst = rawData();
+ typename std :: initializer_list <typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> :: const_iterator first = list.begin();
+ const typename std :: initializer_list <typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> :: const_iterator last = list.end();
+ if (list.size() > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ fixedCapacityVectorUninitializedCopy(first, last, dataFirst);
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, list.size());
+ Size = list.size();
+}
+#endif
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVector <Type, Capacity> :: ~fixedCapacityVector()
+{
+ clear();
+}
+#endif
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: capacity() const
+#else
+template <class Type, std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: capacity() const noexcept
+#endif
+{
+ return Capacity;
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: data()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: data() noexcept
+#endif
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer>(Data);
+ #else
+ #if (__cplusplus < 202002)
+ return std :: launder(reinterpret_cast<typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer>(Data));
+ #else
+ return Data.Elements;
+ #endif
+ #endif
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_pointer shMath :: fixedCapacityVector <Type, Capacity> :: data() const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_pointer shMath :: fixedCapacityVector <Type, Capacity> :: data() const noexcept
+#endif
+{
+ #if (__cplusplus < 201703)
+ return reinterpret_cast<typename shMath :: fixedCapacityVector<Type, Capacity> :: const_pointer>(Data);
+ #else
+ #if (__cplusplus < 202002)
+ return std :: launder(reinterpret_cast<typename shMath :: fixedCapacityVector<Type, Capacity> :: const_pointer>(Data));
+ #else
+ return Data.Elements;
+ #endif
+ #endif
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: begin()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: begin() noexcept
+#endif
+{
+ return data();
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator shMath :: fixedCapacityVector <Type, Capacity> :: begin() const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator shMath :: fixedCapacityVector <Type, Capacity> :: begin() const noexcept
+#endif
+{
+ return data();
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: end()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: end() noexcept
+#endif
+{
+ return data() + Size;
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator shMath :: fixedCapacityVector <Type, Capacity> :: end() const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator shMath :: fixedCapacityVector <Type, Capacity> :: end() const noexcept
+#endif
+{
+ return data() + Size;
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: rbegin()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: rbegin() noexcept
+#endif
+{
+ return typename shMath :: fixedCapacityVector <Type, Capacity> :: reverse_iterator(end());
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: rbegin() const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: rbegin() const noexcept
+#endif
+{
+ return typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reverse_iterator(end());
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: rend()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: rend() noexcept
+#endif
+{
+ return typename shMath :: fixedCapacityVector <Type, Capacity> :: reverse_iterator(begin());
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: rend() const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: rend() const noexcept
+#endif
+{
+ return typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reverse_iterator(begin());
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator shMath :: fixedCapacityVector <Type, Capacity> :: cbegin() const noexcept
+{
+ return begin();
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator shMath :: fixedCapacityVector <Type, Capacity> :: cend() const noexcept
+{
+ return end();
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: crbegin() const noexcept
+{
+ return rbegin();
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <Type, Capacity> :: crend() const noexcept
+{
+ return rend();
+}
+#endif
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: rawData()
+{
+ #if (__cplusplus < 202002)
+ return reinterpret_cast<typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer>(Data);
+ #else
+ return Data.Elements;
+ #endif
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVector <Type, Capacity> :: empty() const
+#else
+#if (__cplusplus < 202002)
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVector <Type, Capacity> :: empty() const noexcept
+#else
+template <class Type, std :: size_t Capacity> [[nodiscard]] inline constexpr bool shMath :: fixedCapacityVector <Type, Capacity> :: empty() const noexcept
+#endif
+#endif
+{
+ return (Size == 0u);
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n) noexcept
+#endif
+{
+ return *(data() + n);
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n) const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n) const noexcept
+#endif
+{
+ return *(data() + n);
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: front()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: front() & noexcept
+#endif
+{
+ return *data();
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: front() const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: front() const & noexcept
+#endif
+{
+ return *data();
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference shMath :: fixedCapacityVector <Type, Capacity> :: front() && noexcept
+{
+ return std :: move(*data());
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_rvalue_reference shMath :: fixedCapacityVector <Type, Capacity> :: front() const && noexcept
+{
+ return std :: move(*data());
+}
+#endif
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: back()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: back() & noexcept
+#endif
+{
+ return *(data() + Size - 1u);
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: back() const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: back() const & noexcept
+#endif
+{
+ return *(data() + Size - 1u);
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference shMath :: fixedCapacityVector <Type, Capacity> :: back() && noexcept
+{
+ return std :: move(*(data() + Size - 1u));
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_rvalue_reference shMath :: fixedCapacityVector <Type, Capacity> :: back() const && noexcept
+{
+ return std :: move(*(data() + Size - 1u));
+}
+#endif
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: at(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ if (n >= Size)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *(data() + n);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: at(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n) const
+{
+ if (n >= Size)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *(data() + n);
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: pop_back()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: pop_back() noexcept(std :: is_nothrow_destructible<Type>{})
+#endif
+{
+ const size_type n = Size - 1u;
+ (data() + n)->~Type();
+ Size = n;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: push_back(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+{
+ const size_type n = Size;
+ if (capacity() == n)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ Type* const address = rawData() + n;
+ #if (__cplusplus < 202002)
+ new (address) Type (val);
+ #else
+ std :: construct_at(address, val);
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(n, n + 1u);
+ Size = n + 1u;
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: push_back(typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference val)
+{
+ const size_type n = Size;
+ if (capacity() == n)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ Type* const address = rawData() + n;
+ #if (__cplusplus < 202002)
+ new (address) Type (std :: forward<Type>(val));
+ #else
+ std :: construct_at(address, std :: forward<Type>(val));
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(n, n + 1u);
+ Size = n + 1u;
+}
+#endif
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: try_push_back(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: try_push_back(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val) noexcept(std :: is_nothrow_copy_constructible<Type>{})
+#endif
+{
+ if (capacity() == Size)
+ {
+  fixedCapacityVectorRecordOverflow<Type, Capacity>();
+  return 0;
+ }
+ unchecked_push_back(val);
+ return data() + Size - 1u;
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: unchecked_push_back(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: unchecked_push_back(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val) noexcept(std :: is_nothrow_copy_constructible<Type>{})
+#endif
+{
+ const size_type n = Size;
+ Type* const address = rawData() + n;
+ #if (__cplusplus < 202002)
+ new (address) Type (val);
+ #else
+ std :: construct_at(address, val);
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(n, n + 1u);
+ Size = n + 1u;
+ return *(data() + n);
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: try_push_back(typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference val) noexcept(std :: is_nothrow_move_constructible<Type>{})
+{
+ return try_emplace_back(std :: move(val));
+}
+
+template <class Type, std :: size_t Capacity> template <class ... Args> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: try_emplace_back(Args&& ... args) noexcept(std :: is_nothrow_constructible<Type, Args&& ...>{})
+{
+ if (capacity() == Size)
+ {
+  fixedCapacityVectorRecordOverflow<Type, Capacity>();
+  return nullptr;
+ }
+ unchecked_emplace_back(std :: forward<Args>(args)...);
+ return data() + Size - 1u;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: unchecked_push_back(typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference val) noexcept(std :: is_nothrow_move_constructible<Type>{})
+{
+ return unchecked_emplace_back(std :: move(val));
+}
+
+template <class Type, std :: size_t Capacity> template <class ... Args> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: unchecked_emplace_back(Args&& ... args) noexcept(std :: is_nothrow_constructible<Type, Args&& ...>{})
+{
+ const size_type n = Size;
+ Type* const address = rawData() + n;
+ #if (__cplusplus < 202002)
+ new (address) Type (std :: forward<Args>(args)...);
+ #else
+ std :: construct_at(address, std :: forward<Args>(args)...);
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(n, n + 1u);
+ Size = n + 1u;
+ return *(data() + n);
+}
+#endif
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: size() const
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: size() const noexcept
+#endif
+{
+ return Size;
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> void shMath :: fixedCapacityVector <Type, Capacity> :: clear()
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: clear() noexcept(std :: is_nothrow_destructible<Type>{})
+#endif
+{
+ truncate(0u);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ const size_type initialSize = Size;
+ Type* first = rawData() + initialSize;
+ Type* const last = rawData() + n;
+ SH_MATH_TRY
+ {
+  #if (__cplusplus < 202002)
+  for(;first != last;++first) new (first) Type();
+  #else
+  for(;first != last;++first) std :: construct_at(first);
+  #endif
+ }
+ SH_MATH_CATCH_ALL
+ {
+  Size = std :: distance(rawData(), first);
+  for(;Size != initialSize;--Size)
+  {
+   SH_MATH_TRY
+   {
+    #if (__cplusplus < 201703)
+    (--first)->~Type();
+    #else
+    std :: launder(--first)->~Type();
+    #endif
+   }
+   SH_MATH_CATCH_ALL
+   {
+    return; //Nothing better could be done, just pretend everything is ok.
+   }
+  }
+  SH_MATH_RETHROW;
+ }
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+ Size = n;
+}
+
+#if (__cplusplus < 201103)
+#else
+#if (__cplusplus < 201703)
+template <class Type, std :: size_t Capacity> template <class ... Args> inline void shMath :: fixedCapacityVector <Type, Capacity> :: emplace_back(Args&& ... args)
+#else
+#if (__cplusplus < 202002)
+template <class Type, std :: size_t Capacity> template <class ... Args> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: emplace_back(Args&& ... args)
+#else
+template <class Type, std :: size_t Capacity> template <class ... Args> constexpr inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: emplace_back(Args&& ... args)
+#endif
+#endif
+{
+ const size_type n = Size;
+ if (capacity() == n)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ Type* const address = rawData() + n;
+ #if (__cplusplus < 202002)
+ new (address) Type (std :: forward<Args>(args)...);
+ #else
+ std :: construct_at(address, std :: forward<Args>(args)...);
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(n, n + 1u);
+ Size = n + 1u;
+ #if (__cplusplus < 201703)
+ #else
+ #if (__cplusplus < 202002)
+ return *std :: launder(address);
+ #else
+ return *address;
+ #endif
+ #endif
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>, std :: integral_constant<bool, false>)
+{
+ fillN(n);
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>, std :: integral_constant<bool, true>)
+{
+ #if (__cplusplus < 201703)
+ Type* first = rawData() + Size;
+ Type* const last = rawData() + n;
+ SH_MATH_TRY
+ {
+  for(;first != last;++first) new (first) Type();
+ }
+ SH_MATH_CATCH_ALL
+ {
+  Type* const Begin = rawData() + Size;
+  while(first != Begin) (--first)->~Type();
+  SH_MATH_RETHROW;
+ }
+ #else
+ Type* const first = rawData() + Size;
+ std :: uninitialized_default_construct_n(first, n - Size);
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+ Size = n;
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>, std :: integral_constant<bool, false>) noexcept
+{
+ #if (__cplusplus < 201703)
+ Type* first = rawData() + Size;
+ Type* const last = rawData() + n;
+ while(first != last) new (first++) Type();
+ #else
+ Type* const first = rawData() + Size;
+ std :: uninitialized_default_construct_n(first, n - Size);
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+ Size = n;
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>, std :: integral_constant<bool, true>) noexcept
+{
+ fillN(n, std :: integral_constant<bool, true>{}, std :: integral_constant<bool, false>{});
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: copyN(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_pointer first, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>)
+{
+ fixedCapacityVectorUninitializedCopy(first, first + n, rawData());
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: copyN(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_pointer first, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>) noexcept
+{
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  fixedCapacityVectorUninitializedCopy(first, first + n, rawData());
+  return;
+ }
+ #endif
+ std :: memcpy(rawData(), first, n * sizeof(Type));
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: moveN(typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer first, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>)
+{
+ fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(first), std :: make_move_iterator(first + n), rawData());
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: moveN(typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer first, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>) noexcept
+{
+ copyN(first, n, std :: integral_constant<bool, true>{});
+}
+#endif
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: truncate(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ #if (__cplusplus < 201103)
+ while (Size != n) pop_back();
+ #else
+ truncate(n, std :: is_trivially_destructible<Type>{});
+ #endif
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: truncate(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>) noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ while (Size != n) pop_back();
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: truncate(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>) noexcept
+{
+ Size = n;
+}
+#endif
+
+template <class Type, std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <Type, Capacity>& shMath :: fixedCapacityVector <Type, Capacity> :: operator = (const shMath :: fixedCapacityVector<Type, AnotherCapacity>& a)
+{
+ assign(a.begin(), a.end());
+ return *this;
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVector <Type, Capacity>& shMath :: fixedCapacityVector <Type, Capacity> :: operator = (const shMath :: fixedCapacityVector<Type, Capacity>& a)
+{
+ if (this != &a)
+ {
+  assign(a.begin(), a.end());
+ }
+ return *this;
+}
+#else
+template <class Type, std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <Type, Capacity>& shMath :: fixedCapacityVector <Type, Capacity> :: operator = (shMath :: fixedCapacityVector<Type, AnotherCapacity>&& a)
+{
+ assign(std :: make_move_iterator(a.begin()), std :: make_move_iterator(a.end()));
+ return *this;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <Type, Capacity>& shMath :: fixedCapacityVector <Type, Capacity> :: operator = (std :: initializer_list<typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> list)
+{
+ assign(list.begin(), list.end());
+ return *this;
+}
+#endif
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: insert(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator pos, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+{
+ return insert(pos, static_cast<size_type>(1u), val);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: insert(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator pos, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+{
+ const size_type offset = static_cast<size_type>(pos - data());
+ if (n > Capacity - Size)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ #if (__cplusplus < 201103)
+ return insertFillN(offset, n, val);
+ #else
+ return insertFillN(offset, n, val, std :: is_trivially_copyable<Type>{});
+ #endif
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> template <class InputIterator> typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: insert(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator pos, InputIterator first, InputIterator last)
+#else
+template <class Type, std :: size_t Capacity> template <class InputIterator, class> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: insert(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator pos, InputIterator first, InputIterator last)
+#endif
+{
+ const size_type offset = static_cast<size_type>(pos - data());
+ return insertRange(offset, first, last, typename std :: iterator_traits<InputIterator> :: iterator_category());
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: insert(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator pos, typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference val)
+{
+ return emplace(pos, std :: move(val));
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: insert(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator pos, std :: initializer_list<typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> list)
+{
+ return insert(pos, list.begin(), list.end());
+}
+
+template <class Type, std :: size_t Capacity> template <class ... Args> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: emplace(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator pos, Args&& ... args)
+{
+ const size_type offset = static_cast<size_type>(pos - data());
+ emplace_back(std :: forward<Args>(args)...);
+ std :: rotate(data() + offset, data() + Size - 1u, data() + Size);
+ return data() + offset;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: assign(std :: initializer_list<typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> list)
+{
+ assign(list.begin(), list.end());
+}
+#endif
+
+#if (__cplusplus < 202002)
+#else
+template <class Type, std :: size_t Capacity> template <class Range> constexpr void shMath :: fixedCapacityVector <Type, Capacity> :: append_range(Range&& range)
+{
+ if constexpr (std :: ranges :: forward_range<Range> || std :: ranges :: sized_range<Range>)
+ {
+  if (static_cast<size_type>(std :: ranges :: distance(range)) > Capacity - Size)
+  {
+   fixedCapacityVectorOverflow<Type, Capacity>();
+  }
+  size_type n = Size;
+  for (auto&& element : range)
+  {
+   std :: construct_at(rawData() + n, std :: forward<decltype(element)>(element));
+   fixedCapacityVectorRecordGrowth<Type, Capacity>(n, n + 1u);
+   Size = ++n;
+  }
+ }
+ else
+ {
+  for (auto&& element : range) emplace_back(std :: forward<decltype(element)>(element));
+ }
+}
+#endif
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: erase(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator pos)
+{
+ return erase(pos, pos + 1);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: erase(typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator first, typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator last)
+{
+ const size_type offset = static_cast<size_type>(first - data());
+ const size_type n = static_cast<size_type>(last - first);
+ if (n != 0u)
+ {
+  #if (__cplusplus < 201103)
+  eraseN(offset, n);
+  #else
+  eraseN(offset, n, std :: is_trivially_copyable<Type>{});
+  #endif
+ }
+ return data() + offset;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: resize(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ if (n < Size)
+ {
+  truncate(n);
+ }
+ else
+ {
+  fillN(n);
+ }
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: resize(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+{
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ if (n < Size)
+ {
+  truncate(n);
+ }
+ else
+ {
+  fixedCapacityVectorUninitializedFill(rawData() + Size, rawData() + n, val);
+  fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+  Size = n;
+ }
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: resize_default_init(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ if (n < Size)
+ {
+  truncate(n);
+ }
+ else
+ {
+  #if (__cplusplus < 201103)
+  fillN(n);
+  #else
+  growDefaultInit(n, std :: is_trivially_default_constructible<Type>{});
+  #endif
+ }
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: spare_capacity()
+{
+ return rawData() + Size;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: commit(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ if (n > Capacity - Size)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, Size + n);
+ Size += n;
+}
+
+template <class Type, std :: size_t Capacity> template <class Operation> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: write_into(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, Operation op)
+{
+ if (n > Capacity - Size)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ const size_type written = static_cast<size_type>(op(spare_capacity(), n));
+ if (written > n)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ commit(written);
+ return written;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: assign(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+{
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ if (n < Size)
+ {
+  std :: fill(data(), data() + n, val);
+  truncate(n);
+ }
+ else
+ {
+  std :: fill(data(), data() + Size, val);
+  fixedCapacityVectorUninitializedFill(rawData() + Size, rawData() + n, val);
+  fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+  Size = n;
+ }
+}
+
+#if (__cplusplus < 201103)
+template <class Type, std :: size_t Capacity> template <class InputIterator> inline void shMath :: fixedCapacityVector <Type, Capacity> :: assign(InputIterator first, InputIterator last)
+#else
+template <class Type, std :: size_t Capacity> template <class InputIterator, class> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: assign(InputIterator first, InputIterator last)
+#endif
+{
+ assignRange(first, last, typename std :: iterator_traits<InputIterator> :: iterator_category());
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: swap(shMath :: fixedCapacityVector<Type, Capacity>& a)
+{
+ if (Size < a.Size)
+ {
+  a.swap(*this);
+  return;
+ }
+ if (this == &a)
+ {
+  return;
+ }
+ const size_type common = a.Size;
+ std :: swap_ranges(data(), data() + common, a.data());
+ #if (__cplusplus < 201103)
+ fixedCapacityVectorUninitializedCopy(data() + common, data() + Size, a.rawData() + common);
+ #else
+ fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(data() + common), std :: make_move_iterator(data() + Size), a.rawData() + common);
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(a.Size, Size);
+ a.Size = Size;
+ truncate(common);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: swap(shMath :: fixedCapacityVector<Type, Capacity>& a, shMath :: fixedCapacityVector<Type, Capacity>& b)
+{
+ a.swap(b);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: iterator shMath :: fixedCapacityVector <Type, Capacity> :: find(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+{
+ return data() + (fixedCapacityVectorFind(data(), data() + Size, val) - data());
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_iterator shMath :: fixedCapacityVector <Type, Capacity> :: find(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val) const
+{
+ return fixedCapacityVectorFind(data(), data() + Size, val);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: count(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val) const
+{
+ return fixedCapacityVectorCount(data(), data() + Size, val);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVector <Type, Capacity> :: contains(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val) const
+{
+ return (find(val) != end());
+}
+
+template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator == (const shMath :: fixedCapacityVector<Type, Capacity>& a, const shMath :: fixedCapacityVector<Type, AnotherCapacity>& b)
+{
+ return ((a.size() == b.size()) && fixedCapacityVectorEqual(a.data(), a.data() + a.size(), b.data()));
+}
+
+template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator != (const shMath :: fixedCapacityVector<Type, Capacity>& a, const shMath :: fixedCapacityVector<Type, AnotherCapacity>& b)
+{
+ return !(a == b);
+}
+
+template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator < (const shMath :: fixedCapacityVector<Type, Capacity>& a, const shMath :: fixedCapacityVector<Type, AnotherCapacity>& b)
+{
+ return std :: lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+}
+
+template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator > (const shMath :: fixedCapacityVector<Type, Capacity>& a, const shMath :: fixedCapacityVector<Type, AnotherCapacity>& b)
+{
+ return (b < a);
+}
+
+template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator <= (const shMath :: fixedCapacityVector<Type, Capacity>& a, const shMath :: fixedCapacityVector<Type, AnotherCapacity>& b)
+{
+ return !(b < a);
+}
+
+template <class Type, std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator >= (const shMath :: fixedCapacityVector<Type, Capacity>& a, const shMath :: fixedCapacityVector<Type, AnotherCapacity>& b)
+{
+ return !(a < b);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: insertFillN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+{
+ Type* const oldEnd = rawData() + Size;
+ fixedCapacityVectorUninitializedFill(oldEnd, oldEnd + n, val);
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, Size + n);
+ Size += n;
+ std :: rotate(data() + offset, data() + Size - n, data() + Size);
+ return data() + offset;
+}
+
+template <class Type, std :: size_t Capacity> template <class ForwardIterator> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: insertCopyN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, ForwardIterator first, ForwardIterator last, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ fixedCapacityVectorUninitializedCopy(first, last, rawData() + Size);
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, Size + n);
+ Size += n;
+ std :: rotate(data() + offset, data() + Size - n, data() + Size);
+ return data() + offset;
+}
+
+template <class Type, std :: size_t Capacity> template <class InputIterator> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: insertRange(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, InputIterator first, InputIterator last, std :: input_iterator_tag)
+{
+ const size_type initialSize = Size;
+ SH_MATH_TRY
+ {
+  for(;first != last;++first) push_back(*first);
+ }
+ SH_MATH_CATCH_ALL
+ {
+  truncate(initialSize);
+  SH_MATH_RETHROW;
+ }
+ std :: rotate(data() + offset, data() + initialSize, data() + Size);
+ return data() + offset;
+}
+
+template <class Type, std :: size_t Capacity> template <class ForwardIterator> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: insertRange(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, ForwardIterator first, ForwardIterator last, std :: forward_iterator_tag)
+{
+ const size_type n = static_cast<size_type>(std :: distance(first, last));
+ if (n > Capacity - Size)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ #if (__cplusplus < 201103)
+ return insertCopyN(offset, first, last, n);
+ #else
+ return insertCopyN(offset, first, last, n, std :: is_trivially_copyable<Type>{});
+ #endif
+}
+
+template <class Type, std :: size_t Capacity> template <class InputIterator> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: assignRange(InputIterator first, InputIterator last, std :: input_iterator_tag)
+{
+ clear();
+ for(;first != last;++first) push_back(*first);
+}
+
+template <class Type, std :: size_t Capacity> template <class ForwardIterator> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: assignRange(ForwardIterator first, ForwardIterator last, std :: forward_iterator_tag)
+{
+ const size_type n = static_cast<size_type>(std :: distance(first, last));
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<Type, Capacity>();
+ }
+ if (n < Size)
+ {
+  std :: copy(first, last, data());
+  truncate(n);
+ }
+ else
+ {
+  ForwardIterator middle = first;
+  std :: advance(middle, Size);
+  std :: copy(first, middle, data());
+  fixedCapacityVectorUninitializedCopy(middle, last, rawData() + Size);
+  fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+  Size = n;
+ }
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 void shMath :: fixedCapacityVector <Type, Capacity> :: eraseN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+{
+ #if (__cplusplus < 201103)
+ std :: copy(data() + offset + n, data() + Size, data() + offset);
+ #else
+ std :: move(data() + offset + n, data() + Size, data() + offset);
+ #endif
+ truncate(Size - n);
+}
+
+#if (__cplusplus < 201103)
+#else
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: insertFillN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val, std :: integral_constant<bool, false>)
+{
+ return insertFillN(offset, n, val);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: insertFillN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val, std :: integral_constant<bool, true>) noexcept
+{
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  return insertFillN(offset, n, val);
+ }
+ #endif
+ const Type copy(val); //val may live in the tail that is about to move.
+ Type* const position = rawData() + offset;
+ std :: memmove(position + n, position, (Size - offset) * sizeof(Type));
+ fixedCapacityVectorUninitializedFill(position, position + n, copy);
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, Size + n);
+ Size += n;
+ return data() + offset;
+}
+
+template <class Type, std :: size_t Capacity> template <class ForwardIterator> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: insertCopyN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, ForwardIterator first, ForwardIterator last, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>)
+{
+ return insertCopyN(offset, first, last, n);
+}
+
+template <class Type, std :: size_t Capacity> template <class ForwardIterator> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: insertCopyN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, ForwardIterator first, ForwardIterator last, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>)
+{
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  return insertCopyN(offset, first, last, n);
+ }
+ #endif
+ Type* const position = rawData() + offset;
+ const size_type tail = Size - offset;
+ std :: memmove(position + n, position, tail * sizeof(Type));
+ SH_MATH_TRY
+ {
+  fixedCapacityVectorUninitializedCopy(first, last, position);
+ }
+ SH_MATH_CATCH_ALL
+ {
+  std :: memmove(position, position + n, tail * sizeof(Type));
+  SH_MATH_RETHROW;
+ }
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, Size + n);
+ Size += n;
+ return data() + offset;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: eraseN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>)
+{
+ eraseN(offset, n);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: eraseN(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type offset, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>) noexcept
+{
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  eraseN(offset, n);
+  return;
+ }
+ #endif
+ Type* const position = rawData() + offset;
+ std :: memmove(position, position + n, (Size - offset - n) * sizeof(Type));
+ Size -= n;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: growDefaultInit(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, false>)
+{
+ fillN(n);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <Type, Capacity> :: growDefaultInit(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n, std :: integral_constant<bool, true>) noexcept
+{
+ #if (__cplusplus < 202002)
+ #else
+ if (std :: is_constant_evaluated())
+ {
+  fillN(n); //Constant evaluation must not read indeterminate values, so value-initialise instead.
+  return;
+ }
+ #endif
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+ Size = n;
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+template <class Type> constexpr inline std :: size_t shMath :: fixedCapacityVectorWireOffset() noexcept
+{
+ return (sizeof(fixedCapacityVectorWireHeader) + alignof(Type) - 1u) / alignof(Type) * alignof(Type);
+}
+
+template <class Type> inline const unsigned char* shMath :: fixedCapacityVectorWireElements(const void* buffer, std :: size_t bytes, std :: size_t capacity, std :: size_t& size) noexcept
+{
+ fixedCapacityVectorWireHeader header;
+ if ((buffer == nullptr) || (bytes < sizeof(header)))
+ {
+  return nullptr;
+ }
+ std :: memcpy(&header, buffer, sizeof(header));
+ const std :: uint32_t magic = fixedCapacityVectorWireHeader :: magic;
+ const std :: uint16_t version = fixedCapacityVectorWireHeader :: version;
+ const std :: uint16_t byteOrder = fixedCapacityVectorWireHeader :: byteOrder;
+ if ((header.Magic != magic) || (header.Version != version) || (header.ByteOrder != byteOrder) || (header.ElementSize != sizeof(Type)) || (header.DataOffset != fixedCapacityVectorWireOffset<Type>()))
+ {
+  return nullptr;
+ }
+ if ((header.Size > capacity) || (bytes < header.DataOffset) || (header.Size > (bytes - header.DataOffset) / sizeof(Type)))
+ {
+  return nullptr;
+ }
+ size = static_cast<std :: size_t>(header.Size);
+ return static_cast<const unsigned char*>(buffer) + header.DataOffset;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: serialized_size() const noexcept
+{
+ static_assert(std :: is_trivially_copyable<Type> :: value, "Only vectors of trivially copyable elements can be serialized.");
+ return fixedCapacityVectorWireOffset<Type>() + Size * sizeof(Type);
+}
+
+template <class Type, std :: size_t Capacity> typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: serialize_to(void* buffer, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type bytes) const noexcept
+{
+ const size_type result = serialized_size();
+ if ((buffer == nullptr) || (bytes < result))
+ {
+  return 0u;
+ }
+ fixedCapacityVectorWireHeader header;
+ header.Magic = fixedCapacityVectorWireHeader :: magic;
+ header.Version = fixedCapacityVectorWireHeader :: version;
+ header.ByteOrder = fixedCapacityVectorWireHeader :: byteOrder;
+ header.ElementSize = sizeof(Type);
+ header.DataOffset = fixedCapacityVectorWireOffset<Type>();
+ header.Size = Size;
+ unsigned char* const first = static_cast<unsigned char*>(buffer);
+ std :: memcpy(first, &header, sizeof(header));
+ std :: memset(first + sizeof(header), 0, header.DataOffset - sizeof(header));
+ std :: memcpy(first + header.DataOffset, static_cast<const void*>(data()), Size * sizeof(Type));
+ return result;
+}
+
+template <class Type, std :: size_t Capacity> bool shMath :: fixedCapacityVector <Type, Capacity> :: deserialize_from(const void* buffer, typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type bytes) noexcept
+{
+ static_assert(std :: is_trivially_copyable<Type> :: value, "Only vectors of trivially copyable elements can be deserialized.");
+ size_type n = 0u;
+ const unsigned char* const elements = fixedCapacityVectorWireElements<Type>(buffer, bytes, Capacity, n);
+ if (elements == nullptr)
+ {
+  return false;
+ }
+ Size = 0u;
+ std :: memcpy(static_cast<void*>(rawData()), elements, n * sizeof(Type));
+ fixedCapacityVectorRecordGrowth<Type, Capacity>(Size, n);
+ Size = n;
+ return true;
+}
+
+#if (__cplusplus < 202002)
+#else
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: serialize_to(std :: span<std :: byte> buffer) const noexcept
+{
+ return serialize_to(buffer.data(), buffer.size());
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVector <Type, Capacity> :: deserialize_from(std :: span<const std :: byte> buffer) noexcept
+{
+ return deserialize_from(buffer.data(), buffer.size());
+}
+#endif
+
+template <class Type, std :: size_t Capacity> constexpr inline shMath :: fixedCapacityVectorView <Type, Capacity> :: fixedCapacityVectorView() noexcept
+: Data(nullptr), Size(0u)
+{
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVectorView <Type, Capacity> :: attach(const void* buffer, typename shMath :: fixedCapacityVectorView <Type, Capacity> :: size_type bytes) noexcept
+{
+ size_type n = 0u;
+ const unsigned char* const elements = fixedCapacityVectorWireElements<Type>(buffer, bytes, Capacity, n);
+ if ((elements == nullptr) || ((reinterpret_cast<std :: uintptr_t>(elements) % alignof(Type)) != 0u))
+ {
+  Data = nullptr;
+  Size = 0u;
+  return false;
+ }
+ Data = reinterpret_cast<const Type*>(elements);
+ Size = n;
+ return true;
+}
+
+#if (__cplusplus < 202002)
+#else
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVectorView <Type, Capacity> :: attach(std :: span<const std :: byte> buffer) noexcept
+{
+ return attach(buffer.data(), buffer.size());
+}
+#endif
+
+template <class Type, std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: size_type shMath :: fixedCapacityVectorView <Type, Capacity> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_pointer shMath :: fixedCapacityVectorView <Type, Capacity> :: data() const noexcept
+{
+ return Data;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: size_type shMath :: fixedCapacityVectorView <Type, Capacity> :: size() const noexcept
+{
+ return Size;
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVectorView <Type, Capacity> :: empty() const noexcept
+{
+ return (Size == 0u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_iterator shMath :: fixedCapacityVectorView <Type, Capacity> :: begin() const noexcept
+{
+ return Data;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_iterator shMath :: fixedCapacityVectorView <Type, Capacity> :: end() const noexcept
+{
+ return Data + Size;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_iterator shMath :: fixedCapacityVectorView <Type, Capacity> :: cbegin() const noexcept
+{
+ return Data;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_iterator shMath :: fixedCapacityVectorView <Type, Capacity> :: cend() const noexcept
+{
+ return Data + Size;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVectorView <Type, Capacity> :: rbegin() const noexcept
+{
+ return const_reverse_iterator(end());
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVectorView <Type, Capacity> :: rend() const noexcept
+{
+ return const_reverse_iterator(begin());
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_reference shMath :: fixedCapacityVectorView <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVectorView <Type, Capacity> :: size_type n) const noexcept
+{
+ return *(Data + n);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_reference shMath :: fixedCapacityVectorView <Type, Capacity> :: at(typename shMath :: fixedCapacityVectorView <Type, Capacity> :: size_type n) const
+{
+ if (n >= Size)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *(Data + n);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_reference shMath :: fixedCapacityVectorView <Type, Capacity> :: front() const noexcept
+{
+ return *Data;
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_reference shMath :: fixedCapacityVectorView <Type, Capacity> :: back() const noexcept
+{
+ return *(Data + Size - 1u);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: const_iterator shMath :: fixedCapacityVectorView <Type, Capacity> :: find(const typename shMath :: fixedCapacityVectorView <Type, Capacity> :: value_type& val) const
+{
+ return fixedCapacityVectorFind(Data, Data + Size, val);
+}
+
+template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVectorView <Type, Capacity> :: size_type shMath :: fixedCapacityVectorView <Type, Capacity> :: count(const typename shMath :: fixedCapacityVectorView <Type, Capacity> :: value_type& val) const
+{
+ return fixedCapacityVectorCount(Data, Data + Size, val);
+}
+
+template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVectorView <Type, Capacity> :: contains(const typename shMath :: fixedCapacityVectorView <Type, Capacity> :: value_type& val) const
+{
+ return (find(val) != end());
+}
+#endif
+
+#if (__cplusplus < 201103)
+#else
+SH_MATH_CONSTEXPR20 inline unsigned int shMath :: fixedCapacityVectorPopCount(std :: uint64_t word) noexcept
+{
+ #if (__cplusplus < 202002)
+ #if defined(__GNUC__)
+ return static_cast<unsigned int>(__builtin_popcountll(word));
+ #else
+ word = word - ((word >> 1) & 0x5555555555555555u);
+ word = (word & 0x3333333333333333u) + ((word >> 2) & 0x3333333333333333u);
+ return static_cast<unsigned int>((((word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Fu) * 0x0101010101010101u) >> 56);
+ #endif
+ #else
+ return static_cast<unsigned int>(std :: popcount(word));
+ #endif
+}
+
+SH_MATH_CONSTEXPR20 inline unsigned int shMath :: fixedCapacityVectorTrailingZeros(std :: uint64_t word) noexcept
+{
+ #if (__cplusplus < 202002)
+ #if defined(__GNUC__)
+ return static_cast<unsigned int>(__builtin_ctzll(word));
+ #else
+ return fixedCapacityVectorPopCount((word & (0u - word)) - 1u); //Ones below the lowest set bit.
+ #endif
+ #else
+ return static_cast<unsigned int>(std :: countr_zero(word));
+ #endif
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitReference :: fixedCapacityVectorBitReference(std :: uint64_t* word, std :: uint64_t mask) noexcept
+: Word(word), Mask(mask)
+{
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitReference :: operator bool () const noexcept
+{
+ return ((*Word & Mask) != 0u);
+}
+
+SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVectorBitReference :: operator ~ () const noexcept
+{
+ return ((*Word & Mask) == 0u);
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitReference& shMath :: fixedCapacityVectorBitReference :: operator = (bool value) noexcept
+{
+ if (value)
+ {
+  *Word |= Mask;
+ }
+ else
+ {
+  *Word &= ~Mask;
+ }
+ return *this;
+}
+
+SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitReference& shMath :: fixedCapacityVectorBitReference :: operator = (const shMath :: fixedCapacityVectorBitReference& a) noexcept
+{
+ return (*this = static_cast<bool>(a));
+}
+
+SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVectorBitReference :: flip() noexcept
+{
+ *Word ^= Mask;
+}
+
+SH_MATH_CONSTEXPR20 inline void shMath :: swap(shMath :: fixedCapacityVectorBitReference a, shMath :: fixedCapacityVectorBitReference b) noexcept
+{
+ const bool value = a;
+ a = b;
+ b = value;
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: fixedCapacityVectorBitIterator() noexcept
+: Words(nullptr), Index(0u)
+{
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: fixedCapacityVectorBitIterator(Word* words, std :: size_t index) noexcept
+: Words(words), Index(index)
+{
+}
+
+template <class Word, class Reference> template <class AnotherWord, class AnotherReference, class> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: fixedCapacityVectorBitIterator(const shMath :: fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) noexcept
+: Words(a.Words), Index(a.Index)
+{
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: reference shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator * () const noexcept
+{
+ return dereference(Index, std :: is_same<Reference, bool>{});
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: reference shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator [] (typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: difference_type n) const noexcept
+{
+ return dereference(static_cast<std :: size_t>(static_cast<difference_type>(Index) + n), std :: is_same<Reference, bool>{});
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference>& shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator ++ () noexcept
+{
+ ++Index;
+ return *this;
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference> shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator ++ (int) noexcept
+{
+ const fixedCapacityVectorBitIterator previous(*this);
+ ++Index;
+ return previous;
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference>& shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator -- () noexcept
+{
+ --Index;
+ return *this;
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference> shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator -- (int) noexcept
+{
+ const fixedCapacityVectorBitIterator previous(*this);
+ --Index;
+ return previous;
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference>& shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator += (typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: difference_type n) noexcept
+{
+ Index = static_cast<std :: size_t>(static_cast<difference_type>(Index) + n);
+ return *this;
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference>& shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator -= (typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: difference_type n) noexcept
+{
+ Index = static_cast<std :: size_t>(static_cast<difference_type>(Index) - n);
+ return *this;
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference> shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator + (typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: difference_type n) const noexcept
+{
+ fixedCapacityVectorBitIterator result(*this);
+ return (result += n);
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator <Word, Reference> shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator - (typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: difference_type n) const noexcept
+{
+ fixedCapacityVectorBitIterator result(*this);
+ return (result -= n);
+}
+
+template <class Word, class Reference> template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: difference_type shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator - (const shMath :: fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept
+{
+ return static_cast<difference_type>(Index) - static_cast<difference_type>(a.Index);
+}
+
+template <class Word, class Reference> template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator == (const shMath :: fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept
+{
+ return (Index == a.Index);
+}
+
+template <class Word, class Reference> template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator != (const shMath :: fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept
+{
+ return (Index != a.Index);
+}
+
+template <class Word, class Reference> template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator < (const shMath :: fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept
+{
+ return (Index < a.Index);
+}
+
+template <class Word, class Reference> template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator > (const shMath :: fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept
+{
+ return (Index > a.Index);
+}
+
+template <class Word, class Reference> template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator <= (const shMath :: fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept
+{
+ return (Index <= a.Index);
+}
+
+template <class Word, class Reference> template <class AnotherWord, class AnotherReference> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: operator >= (const shMath :: fixedCapacityVectorBitIterator<AnotherWord, AnotherReference>& a) const noexcept
+{
+ return (Index >= a.Index);
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: reference shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: dereference(std :: size_t index, std :: integral_constant<bool, false>) const noexcept
+{
+ return reference(Words + index / 64u, static_cast<std :: uint64_t>(1u) << (index % 64u));
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: reference shMath :: fixedCapacityVectorBitIterator <Word, Reference> :: dereference(std :: size_t index, std :: integral_constant<bool, true>) const noexcept
+{
+ return (((Words[index / 64u] >> (index % 64u)) & 1u) != 0u);
+}
+
+template <class Word, class Reference> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBitIterator<Word, Reference> shMath :: operator + (typename shMath :: fixedCapacityVectorBitIterator<Word, Reference> :: difference_type n, const shMath :: fixedCapacityVectorBitIterator<Word, Reference>& a) noexcept
+{
+ return a + n;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity> :: fixedCapacityVector() noexcept
+: Words(), Size(0u)
+{
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity> :: fixedCapacityVector(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n)
+: Words(), Size(0u)
+{
+ grow(n, false);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity> :: fixedCapacityVector(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n, bool value)
+: Words(), Size(0u)
+{
+ grow(n, value);
+}
+
+template <std :: size_t Capacity> template <class InputIterator, class> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity> :: fixedCapacityVector(InputIterator first, InputIterator last)
+: Words(), Size(0u)
+{
+ assign(first, last);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity> :: fixedCapacityVector(std :: initializer_list<bool> list)
+: Words(), Size(0u)
+{
+ assign(list.begin(), list.end());
+}
+
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity> :: fixedCapacityVector(const shMath :: fixedCapacityVector<bool, AnotherCapacity>& a)
+: Words(), Size(0u)
+{
+ *this = a;
+}
+
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: operator = (const shMath :: fixedCapacityVector<bool, AnotherCapacity>& a)
+{
+ if (a.size() > Capacity)
+ {
+  fixedCapacityVectorOverflow<bool, Capacity>();
+ }
+ const size_type used = usedWords();
+ const size_type copied = a.usedWords();
+ for(size_type i = 0u;i < copied;++i)
+ {
+  Words[i] = a.Words[i];
+ }
+ for(size_type i = copied;i < used;++i)
+ {
+  Words[i] = 0u;
+ }
+ if (a.size() > Size)
+ {
+  fixedCapacityVectorRecordGrowth<bool, Capacity>(Size, a.size());
+ }
+ Size = a.Size;
+ return *this;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: operator = (std :: initializer_list<bool> list)
+{
+ assign(list.begin(), list.end());
+ return *this;
+}
+
+template <std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type shMath :: fixedCapacityVector <bool, Capacity> :: capacity() const noexcept
+{
+ return Capacity;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type shMath :: fixedCapacityVector <bool, Capacity> :: size() const noexcept
+{
+ return Size;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVector <bool, Capacity> :: empty() const noexcept
+{
+ return (Size == 0u);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline const typename shMath :: fixedCapacityVector <bool, Capacity> :: word_type* shMath :: fixedCapacityVector <bool, Capacity> :: words() const noexcept
+{
+ return Words;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: iterator shMath :: fixedCapacityVector <bool, Capacity> :: begin() noexcept
+{
+ return iterator(Words, 0u);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator shMath :: fixedCapacityVector <bool, Capacity> :: begin() const noexcept
+{
+ return const_iterator(Words, 0u);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: iterator shMath :: fixedCapacityVector <bool, Capacity> :: end() noexcept
+{
+ return iterator(Words, Size);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator shMath :: fixedCapacityVector <bool, Capacity> :: end() const noexcept
+{
+ return const_iterator(Words, Size);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: reverse_iterator shMath :: fixedCapacityVector <bool, Capacity> :: rbegin() noexcept
+{
+ return reverse_iterator(end());
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <bool, Capacity> :: rbegin() const noexcept
+{
+ return const_reverse_iterator(end());
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: reverse_iterator shMath :: fixedCapacityVector <bool, Capacity> :: rend() noexcept
+{
+ return reverse_iterator(begin());
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <bool, Capacity> :: rend() const noexcept
+{
+ return const_reverse_iterator(begin());
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator shMath :: fixedCapacityVector <bool, Capacity> :: cbegin() const noexcept
+{
+ return begin();
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator shMath :: fixedCapacityVector <bool, Capacity> :: cend() const noexcept
+{
+ return end();
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <bool, Capacity> :: crbegin() const noexcept
+{
+ return rbegin();
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_reverse_iterator shMath :: fixedCapacityVector <bool, Capacity> :: crend() const noexcept
+{
+ return rend();
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: reference shMath :: fixedCapacityVector <bool, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) noexcept
+{
+ return reference(Words + n / word_bits, static_cast<word_type>(1u) << (n % word_bits));
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_reference shMath :: fixedCapacityVector <bool, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) const noexcept
+{
+ return test(n);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: reference shMath :: fixedCapacityVector <bool, Capacity> :: at(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n)
+{
+ if (n >= Size)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return (*this)[n];
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_reference shMath :: fixedCapacityVector <bool, Capacity> :: at(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) const
+{
+ if (n >= Size)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return test(n);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: reference shMath :: fixedCapacityVector <bool, Capacity> :: front() noexcept
+{
+ return (*this)[0u];
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_reference shMath :: fixedCapacityVector <bool, Capacity> :: front() const noexcept
+{
+ return test(0u);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: reference shMath :: fixedCapacityVector <bool, Capacity> :: back() noexcept
+{
+ return (*this)[Size - 1u];
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_reference shMath :: fixedCapacityVector <bool, Capacity> :: back() const noexcept
+{
+ return test(Size - 1u);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: clear() noexcept
+{
+ const size_type used = usedWords();
+ for(size_type i = 0u;i < used;++i)
+ {
+  Words[i] = 0u;
+ }
+ Size = 0u;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: pop_back() noexcept
+{
+ const size_type n = Size - 1u;
+ Words[n / word_bits] &= ~(static_cast<word_type>(1u) << (n % word_bits));
+ Size = n;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: push_back(bool val)
+{
+ if (capacity() == Size)
+ {
+  fixedCapacityVectorOverflow<bool, Capacity>();
+ }
+ unchecked_push_back(val);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVector <bool, Capacity> :: try_push_back(bool val) noexcept
+{
+ if (capacity() == Size)
+ {
+  fixedCapacityVectorRecordOverflow<bool, Capacity>();
+  return false;
+ }
+ unchecked_push_back(val);
+ return true;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: unchecked_push_back(bool val) noexcept
+{
+ const size_type n = Size;
+ Words[n / word_bits] |= static_cast<word_type>(val) << (n % word_bits);
+ fixedCapacityVectorRecordGrowth<bool, Capacity>(n, n + 1u);
+ Size = n + 1u;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: iterator shMath :: fixedCapacityVector <bool, Capacity> :: insert(typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator pos, bool val)
+{
+ return insert(pos, 1u, val);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <bool, Capacity> :: iterator shMath :: fixedCapacityVector <bool, Capacity> :: insert(typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator pos, typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n, bool val)
+{
+ const size_type offset = static_cast<size_type>(pos - cbegin());
+ if (n > Capacity - Size)
+ {
+  fixedCapacityVectorOverflow<bool, Capacity>();
+ }
+ if (n != 0u)
+ {
+  //Shifts the tail up a word at a time, starting from its top so that no source bit is overwritten before it is read.
+  for(size_type last = Size + n;last > offset + n;)
+  {
+   const size_type first = (last - (offset + n) > word_bits) ? last - word_bits : offset + n;
+   depositBits(first, extractBits(first - n), last - first);
+   last = first;
+  }
+  fillBits(offset, offset + n, val);
+  fixedCapacityVectorRecordGrowth<bool, Capacity>(Size, Size + n);
+  Size += n;
+ }
+ return iterator(Words, offset);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: iterator shMath :: fixedCapacityVector <bool, Capacity> :: erase(typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator pos)
+{
+ return erase(pos, pos + 1);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVector <bool, Capacity> :: iterator shMath :: fixedCapacityVector <bool, Capacity> :: erase(typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator first, typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator last)
+{
+ const size_type offset = static_cast<size_type>(first - cbegin());
+ const size_type n = static_cast<size_type>(last - first);
+ if (n != 0u)
+ {
+  const size_type size = Size - n;
+  for(size_type i = offset;i < size;i += word_bits)
+  {
+   depositBits(i, extractBits(i + n), (size - i < word_bits) ? size - i : word_bits);
+  }
+  truncate(size);
+ }
+ return iterator(Words, offset);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: resize(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n, bool val)
+{
+ if (n > Size)
+ {
+  grow(n, val);
+ }
+ else
+ {
+  truncate(n);
+ }
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: assign(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n, bool val)
+{
+ if (n > Capacity)
+ {
+  fixedCapacityVectorOverflow<bool, Capacity>();
+ }
+ clear();
+ grow(n, val);
+}
+
+template <std :: size_t Capacity> template <class InputIterator, class> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: assign(InputIterator first, InputIterator last)
+{
+ clear();
+ for(;first != last;++first)
+ {
+  push_back(static_cast<bool>(*first));
+ }
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: assign(std :: initializer_list<bool> list)
+{
+ assign(list.begin(), list.end());
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: swap(shMath :: fixedCapacityVector <bool, Capacity>& a) noexcept
+{
+ const size_type n = (usedWords() > a.usedWords()) ? usedWords() : a.usedWords();
+ for(size_type i = 0u;i < n;++i)
+ {
+  std :: swap(Words[i], a.Words[i]);
+ }
+ std :: swap(Size, a.Size);
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: iterator shMath :: fixedCapacityVector <bool, Capacity> :: find(bool val) noexcept
+{
+ return iterator(Words, findBit(0u, val ? 0u : ~static_cast<word_type>(0u)));
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: const_iterator shMath :: fixedCapacityVector <bool, Capacity> :: find(bool val) const noexcept
 {
+ return const_iterator(Words, findBit(0u, val ? 0u : ~static_cast<word_type>(0u)));
 }
 
-template <class Type, std :: size_t Capacity> template <std :: size_t AnotherCapacity> shMath :: fixedCapacityVector<Type, Capacity> :: fixedCapacityVector(const fixedCapacityVector<Type, AnotherCapacity>& a)
-: Size(a.Size)
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type shMath :: fixedCapacityVector <bool, Capacity> :: count(bool val) const noexcept
 {
- Type* const dataFirst = reinterpret_cast<Type*>(Data);
- if (Size > Capacity)
- {
-  throw std :: bad_alloc();
- }
- std :: uninitialized_copy(a.begin(), a.end(), dataFirst);
+ return val ? count() : Size - count();
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(const shMath :: fixedCapacityVector<Type, Capacity>& a)
-#else
-template <class Type, std :: size_t Capacity> shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(const shMath :: fixedCapacityVector<Type, Capacity>& a) noexcept(std :: is_nothrow_copy_constructible<Type>{})
-#endif
-:Size(a.Size)
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVector <bool, Capacity> :: contains(bool val) const noexcept
 {
- Type* const dataFirst = reinterpret_cast<Type*>(Data);
- std :: uninitialized_copy(a.begin(), a.end(), dataFirst);
+ return val ? any() : !all();
 }
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> template <std :: size_t AnotherCapacity> shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(shMath :: fixedCapacityVector<Type, AnotherCapacity>&& a)
-: Size(a.Size)
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type shMath :: fixedCapacityVector <bool, Capacity> :: count() const noexcept
 {
- Type* dataFirst = reinterpret_cast<Type*>(Data);
- Type* const dataLast = dataFirst + Size;
- Type* first = reinterpret_cast<Type*>(a.Data);
- if (Size > Capacity)
- {
-  throw std :: bad_alloc();
- }
- for(;dataFirst != dataLast;++dataFirst,++first)
+ const size_type used = usedWords();
+ size_type result = 0u;
+ for(size_type i = 0u;i < used;++i)
  {
-  #if (__cplusplus < 201703)
-  new (dataFirst) Type(std :: move(*first));
-  #else
-  new (dataFirst) Type(std :: move(*std :: launder(first)));
-  #endif
+  result += fixedCapacityVectorPopCount(Words[i]);
  }
+ return result;
 }
-#endif
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(shMath :: fixedCapacityVector<Type, Capacity>&& a) noexcept(std :: is_nothrow_move_constructible<Type>{})
-: Size(a.Size)
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVector <bool, Capacity> :: all() const noexcept
 {
- Type* dataFirst = reinterpret_cast<Type*>(Data);
- Type* const dataLast = dataFirst + Size;
- Type* first = reinterpret_cast<Type*>(a.Data);
- for(;dataFirst != dataLast;++dataFirst,++first)
+ const size_type full = Size / word_bits;
+ for(size_type i = 0u;i < full;++i)
  {
-  #if (__cplusplus < 201703)
-  new (dataFirst) Type(std :: move(*first));
-  #else
-  new (dataFirst) Type(std :: move(*std :: launder(first)));
-  #endif
+  if (Words[i] != ~static_cast<word_type>(0u))
+  {
+   return false;
+  }
  }
+ return ((Size % word_bits) == 0u) || (Words[full] == lowBits(Size % word_bits));
 }
-#endif
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> shMath :: fixedCapacityVector <Type, Capacity> :: fixedCapacityVector(std :: initializer_list<typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> list)
-: Size(list.size())
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVector <bool, Capacity> :: any() const noexcept
 {
- Type* const dataFirst = reinterpret_cast<Type*>(Data);
- typename std :: initializer_list <typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> :: const_iterator first = list.begin();
- const typename std :: initializer_list <typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type> :: const_iterator last = list.end();
- if (list.size() > Capacity)
+ const size_type used = usedWords();
+ for(size_type i = 0u;i < used;++i)
  {
-  throw std :: bad_alloc();
+  if (Words[i] != 0u)
+  {
+   return true;
+  }
  }
- std :: uninitialized_copy(first, last, dataFirst);
+ return false;
 }
-#endif
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVector <Type, Capacity> :: ~fixedCapacityVector()
-#else
-template <class Type, std :: size_t Capacity> inline shMath :: fixedCapacityVector <Type, Capacity> :: ~fixedCapacityVector() noexcept(std :: is_nothrow_destructible<Type>{})
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVector <bool, Capacity> :: none() const noexcept
 {
- clear();
+ return !any();
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: capacity() const
-#else
-template <class Type, std :: size_t Capacity> constexpr inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: capacity() const noexcept
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type shMath :: fixedCapacityVector <bool, Capacity> :: find_first() const noexcept
 {
- return Capacity;
+ const size_type found = findBit(0u, 0u);
+ return (found == Size) ? npos : found;
 }
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer shMath :: fixedCapacityVector <Type, Capacity> :: data() noexcept
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type shMath :: fixedCapacityVector <bool, Capacity> :: find_next(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type pos) const noexcept
 {
- #if (__cplusplus < 201703)
- return reinterpret_cast<typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer>(Data);
- #else
- return std :: launder(reinterpret_cast<typename shMath :: fixedCapacityVector <Type, Capacity> :: pointer>(Data));
- #endif
+ if (pos >= Size)
+ {
+  return npos;
+ }
+ const size_type found = findBit(pos + 1u, 0u);
+ return (found == Size) ? npos : found;
 }
 
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_pointer shMath :: fixedCapacityVector <Type, Capacity> :: data() const noexcept
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline bool shMath :: fixedCapacityVector <bool, Capacity> :: test(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) const noexcept
 {
- #if (__cplusplus < 201703)
- return reinterpret_cast<typename shMath :: fixedCapacityVector<Type, Capacity> :: const_pointer>(Data);
- #else
- return std :: launder(reinterpret_cast<typename shMath :: fixedCapacityVector<Type, Capacity> :: const_pointer>(Data));
- #endif
+ return (((Words[n / word_bits] >> (n % word_bits)) & 1u) != 0u);
 }
-#endif
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVector <Type, Capacity> :: empty() const
-#else
-#if (__cplusplus < 202002)
-template <class Type, std :: size_t Capacity> inline bool shMath :: fixedCapacityVector <Type, Capacity> :: empty() const noexcept
-#else
-template <class Type, std :: size_t Capacity> [[nodiscard]] inline constexpr bool shMath :: fixedCapacityVector <Type, Capacity> :: empty() const noexcept
-#endif
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: set() noexcept
 {
- return (Size == 0u);
+ fillBits(0u, Size, true);
+ return *this;
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n) noexcept
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: set(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n, bool val) noexcept
 {
- #if (__cplusplus < 201703)
- return *(reinterpret_cast<Type* const>(Data) + n);
- #else
- return *std :: launder(reinterpret_cast<Type* const>(Data) + n);
- #endif
+ (*this)[n] = val;
+ return *this;
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n) const
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: operator [] (typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n) const noexcept
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: reset() noexcept
 {
- #if (__cplusplus < 201703)
- return *(reinterpret_cast<const Type* const>(Data) + n);
- #else
- return *std :: launder(reinterpret_cast<const Type* const>(Data) + n);
- #endif
+ fillBits(0u, Size, false);
+ return *this;
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: front()
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: front() & noexcept
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: reset(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) noexcept
 {
- #if (__cplusplus < 201703)
- return *(reinterpret_cast<Type* const>(Data));
- #else
- return *std :: launder(reinterpret_cast<Type* const>(Data));
- #endif
+ (*this)[n] = false;
+ return *this;
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: front() const
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: front() const & noexcept
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: flip() noexcept
 {
- #if (__cplusplus < 201703)
- return *(reinterpret_cast<const Type* const>(Data));
- #else
- return *std :: launder(reinterpret_cast<const Type* const>(Data));
- #endif
+ const size_type used = usedWords();
+ for(size_type i = 0u;i < used;++i)
+ {
+  Words[i] = ~Words[i];
+ }
+ if ((Size % word_bits) != 0u)
+ {
+  Words[used - 1u] &= lowBits(Size % word_bits);
+ }
+ return *this;
 }
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference shMath :: fixedCapacityVector <Type, Capacity> :: front() && noexcept
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: flip(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) noexcept
 {
- #if (__cplusplus < 201703)
- return std :: move(*(reinterpret_cast<Type* const>(Data)));
- #else
- return std :: move(*std :: launder(reinterpret_cast<Type* const>(Data)));
- #endif
+ Words[n / word_bits] ^= static_cast<word_type>(1u) << (n % word_bits);
+ return *this;
 }
 
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_rvalue_reference shMath :: fixedCapacityVector <Type, Capacity> :: front() const && noexcept
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: operator &= (const shMath :: fixedCapacityVector<bool, AnotherCapacity>& a)
 {
- #if (__cplusplus < 201703)
- return std :: move(*(reinterpret_cast<const Type* const>(Data)));
- #else
- return std :: move(*std :: launder(reinterpret_cast<const Type* const>(Data)));
- #endif
+ checkSize(a);
+ const size_type used = usedWords();
+ for(size_type i = 0u;i < used;++i)
+ {
+  Words[i] &= a.Words[i];
+ }
+ return *this;
 }
-#endif
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: back()
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: back() & noexcept
-#endif
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: operator |= (const shMath :: fixedCapacityVector<bool, AnotherCapacity>& a)
 {
- #if (__cplusplus < 201703)
- return *(reinterpret_cast<Type* const>(Data) + Size - 1u);
- #else
- return *std :: launder(reinterpret_cast<Type* const>(Data) + Size - 1u);
- #endif
+ checkSize(a);
+ const size_type used = usedWords();
+ for(size_type i = 0u;i < used;++i)
+ {
+  Words[i] |= a.Words[i];
+ }
+ return *this;
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: back() const
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: back() const & noexcept
-#endif
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity>& shMath :: fixedCapacityVector <bool, Capacity> :: operator ^= (const shMath :: fixedCapacityVector<bool, AnotherCapacity>& a)
 {
- #if (__cplusplus < 201703)
- return *(reinterpret_cast<const Type* const>(Data) + Size - 1u);
- #else
- return *std :: launder(reinterpret_cast<const Type* const>(Data) + Size - 1u);
- #endif
+ checkSize(a);
+ const size_type used = usedWords();
+ for(size_type i = 0u;i < used;++i)
+ {
+  Words[i] ^= a.Words[i];
+ }
+ return *this;
 }
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference shMath :: fixedCapacityVector <Type, Capacity> :: back() && noexcept
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector <bool, Capacity> shMath :: fixedCapacityVector <bool, Capacity> :: operator ~ () const noexcept
 {
- #if (__cplusplus < 201703)
- return std :: move(*(reinterpret_cast<Type* const>(Data) + Size - 1u));
- #else
- return std :: move(*std :: launder(reinterpret_cast<Type* const>(Data) + Size - 1u));
- #endif
+ fixedCapacityVector result(*this);
+ result.flip();
+ return result;
 }
 
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_rvalue_reference shMath :: fixedCapacityVector <Type, Capacity> :: back() const && noexcept
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: word_type shMath :: fixedCapacityVector <bool, Capacity> :: lowBits(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) noexcept
 {
- #if (__cplusplus < 201703)
- return std :: move(*(reinterpret_cast<const Type* const>(Data) + Size - 1u));
- #else
- return std :: move(*std :: launder(reinterpret_cast<const Type* const>(Data) + Size - 1u));
- #endif
+ return (n < word_bits) ? (static_cast<word_type>(1u) << n) - 1u : ~static_cast<word_type>(0u);
 }
-#endif
 
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: at(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n)
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type shMath :: fixedCapacityVector <bool, Capacity> :: usedWords() const noexcept
 {
- if (n < Size)
+ return (Size + word_bits - 1u) / word_bits;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type shMath :: fixedCapacityVector <bool, Capacity> :: findBit(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type from, typename shMath :: fixedCapacityVector <bool, Capacity> :: word_type invert) const noexcept
+{
+ if (from >= Size)
  {
-  #if (__cplusplus < 201703)
-  return *(reinterpret_cast<Type* const>(Data) + n);
-  #else
-  return *std :: launder(reinterpret_cast<Type* const>(Data) + n);
-  #endif
+  return Size;
+ }
+ const size_type used = usedWords();
+ size_type i = from / word_bits;
+ word_type word = (Words[i] ^ invert) & (~static_cast<word_type>(0u) << (from % word_bits));
+ for(;;)
+ {
+  if (word != 0u)
+  {
+   const size_type found = i * word_bits + fixedCapacityVectorTrailingZeros(word);
+   return (found < Size) ? found : size(); //An inverted search sees the zero bits past Size as matches.
+  }
+  if (++i == used)
+  {
+   return Size;
+  }
+  word = Words[i] ^ invert;
  }
- throw std :: out_of_range("Index out of range.");
 }
 
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: const_reference shMath :: fixedCapacityVector <Type, Capacity> :: at(typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type n) const
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: fillBits(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type first, typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type last, bool val) noexcept
 {
- if (n < Size)
+ while (first < last)
  {
-  #if (__cplusplus < 201703)
-  return *(reinterpret_cast<const Type* const>(Data) + n);
-  #else
-  return *std :: launder(reinterpret_cast<const Type* const>(Data) + n);
-  #endif
+  const size_type offset = first % word_bits;
+  const size_type n = (last - first < word_bits - offset) ? last - first : word_bits - offset;
+  const word_type mask = lowBits(n) << offset;
+  word_type& word = Words[first / word_bits];
+  word = val ? (word | mask) : (word & ~mask);
+  first += n;
  }
- throw std :: out_of_range("Index out of range.");
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: pop_back()
-#else
-template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: pop_back() noexcept(std :: is_nothrow_destructible<Type>{})
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVector <bool, Capacity> :: word_type shMath :: fixedCapacityVector <bool, Capacity> :: extractBits(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type first) const noexcept
 {
- #if (__cplusplus < 201703)
- (reinterpret_cast<Type* const>(Data) + Size - 1u)->~Type();
- #else
- std :: launder(reinterpret_cast<Type* const>(Data) + Size - 1u)->~Type();
- #endif
- --Size;
+ const size_type i = first / word_bits;
+ const size_type offset = first % word_bits;
+ word_type bits = Words[i] >> offset;
+ if ((offset != 0u) && (i + 1u < word_count))
+ {
+  bits |= Words[i + 1u] << (word_bits - offset);
+ }
+ return bits;
 }
 
-template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: push_back(const typename shMath :: fixedCapacityVector <Type, Capacity> :: value_type& val)
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: depositBits(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type first, typename shMath :: fixedCapacityVector <bool, Capacity> :: word_type bits, typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) noexcept
 {
- if (capacity() == Size)
+ const size_type i = first / word_bits;
+ const size_type offset = first % word_bits;
+ const word_type mask = lowBits(n);
+ bits &= mask;
+ Words[i] = (Words[i] & ~(mask << offset)) | (bits << offset);
+ if (offset + n > word_bits)
  {
-  throw std :: bad_alloc();
+  Words[i + 1u] = (Words[i + 1u] & ~(mask >> (word_bits - offset))) | (bits >> (word_bits - offset));
  }
- Type* const address = reinterpret_cast<Type* const>(Data) + Size;
- new (address) Type (val);
- ++Size;
 }
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: push_back(typename shMath :: fixedCapacityVector <Type, Capacity> :: rvalue_reference val)
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: grow(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n, bool val)
 {
- if (capacity() == Size)
+ if (n > Capacity)
  {
-  throw std :: bad_alloc();
+  fixedCapacityVectorOverflow<bool, Capacity>();
  }
- Type* const address = reinterpret_cast<Type* const>(Data) + Size;
- new (address) Type (std :: forward<Type>(val));
- ++Size;
+ if (val)
+ {
+  fillBits(Size, n, true);
+ }
+ fixedCapacityVectorRecordGrowth<bool, Capacity>(Size, n);
+ Size = n;
 }
-#endif
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: size() const
-#else
-template <class Type, std :: size_t Capacity> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: size_type shMath :: fixedCapacityVector <Type, Capacity> :: size() const noexcept
-#endif
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: truncate(typename shMath :: fixedCapacityVector <bool, Capacity> :: size_type n) noexcept
 {
- return Size;
+ fillBits(n, Size, false);
+ Size = n;
 }
 
-#if (__cplusplus < 201103)
-template <class Type, std :: size_t Capacity> void shMath :: fixedCapacityVector <Type, Capacity> :: clear()
-#else
-template <class Type, std :: size_t Capacity> void shMath :: fixedCapacityVector <Type, Capacity> :: clear() noexcept(std :: is_nothrow_destructible<Type>{})
-#endif
+template <std :: size_t Capacity> template <std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVector <bool, Capacity> :: checkSize(const shMath :: fixedCapacityVector<bool, AnotherCapacity>& a) const
 {
- while (Size != 0u) pop_back();
+ if (a.size() != Size)
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
 }
 
-template <class Type, std :: size_t Capacity> void shMath :: fixedCapacityVector <Type, Capacity> :: fillN()
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator == (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, AnotherCapacity>& b) noexcept
 {
- Type* first = reinterpret_cast<Type*>(Data);
- Type* const last = first + Size;
- try
+ if (a.size() != b.size())
  {
-  for(;first != last;++first) new (first) Type();
+  return false;
  }
- catch(...)
+ const std :: size_t used = (a.size() + 63u) / 64u;
+ for(std :: size_t i = 0u;i < used;++i)
  {
-  Size = std :: distance(reinterpret_cast<Type* const>(Data), first);
-  for(;Size != 0u;--Size)
+  if (a.words()[i] != b.words()[i])
   {
-   try
-   {
-    #if (__cplusplus < 201703)
-    (--first)->~Type();
-    #else
-    std :: launder(--first)->~Type();
-    #endif
-   }
-   catch(...)
-   {
-    return; //Nothing better could be done, just pretend everything is ok.
-   }
+   return false;
   }
-  throw;
  }
+ return true;
 }
 
-#if (__cplusplus < 201103)
-#else
-#if (__cplusplus < 201703)
-template <class Type, std :: size_t Capacity> template <class ... Args> inline void shMath :: fixedCapacityVector <Type, Capacity> :: emplace_back(Args&& ... args)
-#else
-#if (__cplusplus < 202002)
-template <class Type, std :: size_t Capacity> template <class ... Args> inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: emplace_back(Args&& ... args)
-#else
-template <class Type, std :: size_t Capacity> template <class ... Args> constexpr inline typename shMath :: fixedCapacityVector <Type, Capacity> :: reference shMath :: fixedCapacityVector <Type, Capacity> :: emplace_back(Args&& ... args)
-#endif
-#endif
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator != (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, AnotherCapacity>& b) noexcept
 {
- if (capacity() == Size)
+ return !(a == b);
+}
+
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator < (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, AnotherCapacity>& b) noexcept
+{
+ const std :: size_t n = (a.size() < b.size()) ? a.size() : b.size();
+ for(std :: size_t i = 0u;i * 64u < n;++i)
  {
-  throw std :: bad_alloc();
+  std :: uint64_t difference = a.words()[i] ^ b.words()[i];
+  if (n - i * 64u < 64u)
+  {
+   difference &= (static_cast<std :: uint64_t>(1u) << (n - i * 64u)) - 1u;
+  }
+  if (difference != 0u)
+  {
+   return ((b.words()[i] & difference & (0u - difference)) != 0u); //The first differing bit decides.
+  }
  }
- Type* const address = reinterpret_cast<Type* const>(Data) + Size;
- new (address) Type (std :: forward<Args>(args)...);
- ++Size;
- #if (__cplusplus < 201703)
- #else
- return *std :: launder(address);
- #endif
+ return (a.size() < b.size());
 }
-#endif
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(std :: integral_constant<bool, false>, std :: integral_constant<bool, false>)
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator > (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, AnotherCapacity>& b) noexcept
 {
- fillN();
+ return (b < a);
 }
-#endif
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(std :: integral_constant<bool, false>, std :: integral_constant<bool, true>)
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator <= (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, AnotherCapacity>& b) noexcept
 {
- #if (__cplusplus < 201703)
- Type* first = reinterpret_cast<Type*>(Data);
- Type* const last = first + Size;
- try
- {
-  for(;first != last;++first) new (first) Type();
- }
- catch(...)
- {
-  Type* const Begin = reinterpret_cast<Type* const>(Data);
-  while(first != Begin) (--first)->~Type();
-  throw;
- }
- #else
- Type* const first = std :: launder(reinterpret_cast<Type* const>(Data));
- std :: uninitialized_default_construct_n(first, Size);
- #endif
+ return !(b < a);
 }
-#endif
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(std :: integral_constant<bool, true>, std :: integral_constant<bool, false>) noexcept
+template <std :: size_t Capacity, std :: size_t AnotherCapacity> SH_MATH_CONSTEXPR20 inline bool shMath :: operator >= (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, AnotherCapacity>& b) noexcept
 {
- #if (__cplusplus < 201703)
- Type* first = reinterpret_cast<Type*>(Data);
- Type* const last = first + Size;
- while(first != last) new (first++) Type();
- #else
- Type* const first = std :: launder(reinterpret_cast<Type* const>(Data));
- std :: uninitialized_default_construct_n(first, Size);
- #endif
+ return !(a < b);
 }
-#endif
 
-#if (__cplusplus < 201103)
-#else
-template <class Type, std :: size_t Capacity> inline void shMath :: fixedCapacityVector <Type, Capacity> :: fillN(std :: integral_constant<bool, true>, std :: integral_constant<bool, true>) noexcept
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector<bool, Capacity> shMath :: operator & (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, Capacity>& b)
+{
+ fixedCapacityVector<bool, Capacity> result(a);
+ result &= b;
+ return result;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector<bool, Capacity> shMath :: operator | (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, Capacity>& b)
+{
+ fixedCapacityVector<bool, Capacity> result(a);
+ result |= b;
+ return result;
+}
+
+template <std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVector<bool, Capacity> shMath :: operator ^ (const shMath :: fixedCapacityVector<bool, Capacity>& a, const shMath :: fixedCapacityVector<bool, Capacity>& b)
 {
- fillN(std :: integral_constant<bool, true>{}, std :: integral_constant<bool, false>{});
+ fixedCapacityVector<bool, Capacity> result(a);
+ result ^= b;
+ return result;
 }
 #endif
 #endif
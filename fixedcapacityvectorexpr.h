@@ -0,0 +1,557 @@
+#ifndef SH_MATH_FIXEDCAPACITYVECTOREXPR
+#define SH_MATH_FIXEDCAPACITYVECTOREXPR
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+#include <cmath>
+
+//Lazy element-wise arithmetic on fixedCapacityVector of arithmetic elements: a * b + c only builds a small tree of nodes holding data pointers,
+//and storing it into a vector runs one fused loop over size() with no intermediate vector.
+namespace shMath
+{
+ template <class Derived> class fixedCapacityVectorExpression
+ {
+  public:
+  SH_MATH_CONSTEXPR20 const Derived& derived() const noexcept;
+  //Evaluates into a new vector; the expression capacity has to fit Capacity, which is checked at compile time.
+  template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 operator fixedCapacityVector<Type, Capacity>() const;
+ };
+
+ //Leaf referring to the elements of a vector.
+ template <class Type, std :: size_t Capacity> class fixedCapacityVectorTerminal : public fixedCapacityVectorExpression<fixedCapacityVectorTerminal<Type, Capacity> >
+ {
+  public:
+  typedef Type value_type;
+  typedef std :: size_t size_type;
+  static constexpr size_type capacity = Capacity;
+  static constexpr bool sized = true;
+  SH_MATH_CONSTEXPR20 explicit fixedCapacityVectorTerminal(const fixedCapacityVector<Type, Capacity>& a) noexcept;
+  SH_MATH_CONSTEXPR20 size_type size() const noexcept;
+  SH_MATH_CONSTEXPR20 value_type operator [] (size_type n) const noexcept;
+  private:
+  const Type* Data;
+  size_type Size;
+ };
+
+ //Leaf broadcasting one value to every index; it has no size of its own.
+ template <class Type> class fixedCapacityVectorScalar : public fixedCapacityVectorExpression<fixedCapacityVectorScalar<Type> >
+ {
+  public:
+  typedef Type value_type;
+  typedef std :: size_t size_type;
+  static constexpr size_type capacity = static_cast<size_type>(-1);
+  static constexpr bool sized = false;
+  SH_MATH_CONSTEXPR20 explicit fixedCapacityVectorScalar(const value_type& value) noexcept;
+  SH_MATH_CONSTEXPR20 size_type size() const noexcept;
+  SH_MATH_CONSTEXPR20 value_type operator [] (size_type n) const noexcept;
+  private:
+  Type Value;
+ };
+
+ template <class Operation, class Operand> class fixedCapacityVectorUnaryExpression : public fixedCapacityVectorExpression<fixedCapacityVectorUnaryExpression<Operation, Operand> >
+ {
+  public:
+  typedef typename Operand :: value_type value_type;
+  typedef std :: size_t size_type;
+  static constexpr size_type capacity = Operand :: capacity;
+  static constexpr bool sized = Operand :: sized;
+  SH_MATH_CONSTEXPR20 explicit fixedCapacityVectorUnaryExpression(const Operand& a) noexcept;
+  SH_MATH_CONSTEXPR20 size_type size() const noexcept;
+  SH_MATH_CONSTEXPR20 value_type operator [] (size_type n) const noexcept;
+  private:
+  Operand A;
+ };
+
+ //Operands of different sizes throw std :: out_of_range when the node is built; the capacity is the smaller one of the operands.
+ template <class Operation, class Left, class Right> class fixedCapacityVectorBinaryExpression : public fixedCapacityVectorExpression<fixedCapacityVectorBinaryExpression<Operation, Left, Right> >
+ {
+  static_assert(std :: is_same<typename Left :: value_type, typename Right :: value_type> :: value, "Operands of a fixedCapacityVector expression should have the same element type.");
+  public:
+  typedef typename Left :: value_type value_type;
+  typedef std :: size_t size_type;
+  static constexpr size_type capacity = (Left :: capacity < Right :: capacity) ? Left :: capacity : Right :: capacity;
+  static constexpr bool sized = Left :: sized || Right :: sized;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorBinaryExpression(const Left& a, const Right& b);
+  SH_MATH_CONSTEXPR20 size_type size() const noexcept;
+  SH_MATH_CONSTEXPR20 value_type operator [] (size_type n) const noexcept;
+  private:
+  Left A;
+  Right B;
+ };
+
+ //a * b + c in one node, written so the compiler may contract it into a fused multiply-add where -ffp-contract allows.
+ template <class Multiplicand, class Multiplier, class Addend> class fixedCapacityVectorFmaExpression : public fixedCapacityVectorExpression<fixedCapacityVectorFmaExpression<Multiplicand, Multiplier, Addend> >
+ {
+  static_assert(std :: is_same<typename Multiplicand :: value_type, typename Multiplier :: value_type> :: value && std :: is_same<typename Multiplicand :: value_type, typename Addend :: value_type> :: value, "Operands of a fixedCapacityVector expression should have the same element type.");
+  public:
+  typedef typename Multiplicand :: value_type value_type;
+  typedef std :: size_t size_type;
+  static constexpr size_type capacity = (Multiplicand :: capacity < Multiplier :: capacity) ? ((Multiplicand :: capacity < Addend :: capacity) ? Multiplicand :: capacity : Addend :: capacity) : ((Multiplier :: capacity < Addend :: capacity) ? Multiplier :: capacity : Addend :: capacity);
+  static constexpr bool sized = Multiplicand :: sized || Multiplier :: sized || Addend :: sized;
+  SH_MATH_CONSTEXPR20 fixedCapacityVectorFmaExpression(const Multiplicand& a, const Multiplier& b, const Addend& c);
+  SH_MATH_CONSTEXPR20 size_type size() const noexcept;
+  SH_MATH_CONSTEXPR20 value_type operator [] (size_type n) const noexcept;
+  private:
+  Multiplicand A;
+  Multiplier B;
+  Addend C;
+ };
+
+ struct fixedCapacityVectorPlus
+ {
+  template <class Type> static SH_MATH_CONSTEXPR20 Type apply(const Type& a, const Type& b) noexcept;
+ };
+
+ struct fixedCapacityVectorMinus
+ {
+  template <class Type> static SH_MATH_CONSTEXPR20 Type apply(const Type& a, const Type& b) noexcept;
+ };
+
+ struct fixedCapacityVectorMultiplies
+ {
+  template <class Type> static SH_MATH_CONSTEXPR20 Type apply(const Type& a, const Type& b) noexcept;
+ };
+
+ struct fixedCapacityVectorDivides
+ {
+  template <class Type> static SH_MATH_CONSTEXPR20 Type apply(const Type& a, const Type& b) noexcept;
+ };
+
+ struct fixedCapacityVectorNegate
+ {
+  template <class Type> static SH_MATH_CONSTEXPR20 Type apply(const Type& a) noexcept;
+ };
+
+ struct fixedCapacityVectorSquare
+ {
+  template <class Type> static SH_MATH_CONSTEXPR20 Type apply(const Type& a) noexcept;
+ };
+
+ //Vectors of arithmetic elements, bar the packed bool ones, and expression nodes take part in expressions; type is the node standing for them.
+ template <class Type, class = void> struct fixedCapacityVectorOperand : std :: integral_constant<bool, false>
+ {
+ };
+
+ template <class Type, std :: size_t Capacity> struct fixedCapacityVectorOperand<fixedCapacityVector<Type, Capacity>, typename std :: enable_if<std :: is_arithmetic<Type> :: value && !std :: is_same<Type, bool> :: value> :: type> : std :: integral_constant<bool, true>
+ {
+  typedef Type value_type;
+  typedef fixedCapacityVectorTerminal<Type, Capacity> type;
+  static SH_MATH_CONSTEXPR20 type make(const fixedCapacityVector<Type, Capacity>& a) noexcept;
+ };
+
+ template <class Type, std :: size_t Capacity, std :: size_t Alignment> struct fixedCapacityVectorOperand<alignedFixedCapacityVector<Type, Capacity, Alignment>, typename std :: enable_if<std :: is_arithmetic<Type> :: value && !std :: is_same<Type, bool> :: value> :: type> : fixedCapacityVectorOperand<fixedCapacityVector<Type, Capacity> >
+ {
+ };
+
+ template <class Expression> struct fixedCapacityVectorOperand<Expression, typename std :: enable_if<std :: is_base_of<fixedCapacityVectorExpression<Expression>, Expression> :: value> :: type> : std :: integral_constant<bool, true>
+ {
+  typedef typename Expression :: value_type value_type;
+  typedef Expression type;
+  static SH_MATH_CONSTEXPR20 const type& make(const Expression& a) noexcept;
+ };
+
+ //Element type of the first operand among Types; absent when all of them are scalars.
+ template <class ... Types> struct fixedCapacityVectorFirstOperand
+ {
+ };
+
+ template <class Type, class ... Types> struct fixedCapacityVectorFirstOperand<Type, Types ...> : fixedCapacityVectorSelect<fixedCapacityVectorOperand<Type> :: value, fixedCapacityVectorOperand<Type>, fixedCapacityVectorFirstOperand<Types ...> > :: type
+ {
+ };
+
+ template <class ... Types> struct fixedCapacityVectorVoid
+ {
+  typedef void type;
+ };
+
+ //Whether ValueType{a} compiles for a const Type& a, which list initialization refuses for narrowing conversions such as double to int; integers still scale floating point vectors, as in a / 2.
+ template <class Type, class ValueType, class = void> struct fixedCapacityVectorNonNarrowing : std :: integral_constant<bool, std :: is_integral<Type> :: value && !std :: is_same<Type, bool> :: value && std :: is_floating_point<ValueType> :: value>
+ {
+ };
+
+ template <class Type, class ValueType> struct fixedCapacityVectorNonNarrowing<Type, ValueType, typename fixedCapacityVectorVoid<decltype(ValueType{std :: declval<const Type&>()})> :: type> : std :: integral_constant<bool, true>
+ {
+ };
+
+ //An operand with element type ValueType, or a value converting to ValueType without narrowing which is broadcast; anything else has no type and drops the operator, so an int vector times 0.5 does not compile instead of scaling by zero.
+ template <class Type, class ValueType, class = void> struct fixedCapacityVectorArgument
+ {
+ };
+
+ template <class Type, class ValueType> struct fixedCapacityVectorArgument<Type, ValueType, typename std :: enable_if<fixedCapacityVectorOperand<Type> :: value && std :: is_same<typename fixedCapacityVectorOperand<Type> :: value_type, ValueType> :: value> :: type> : fixedCapacityVectorOperand<Type>
+ {
+ };
+
+ template <class Type, class ValueType> struct fixedCapacityVectorArgument<Type, ValueType, typename std :: enable_if<!fixedCapacityVectorOperand<Type> :: value && fixedCapacityVectorNonNarrowing<Type, ValueType> :: value> :: type>
+ {
+  typedef fixedCapacityVectorScalar<ValueType> type;
+  static SH_MATH_CONSTEXPR20 type make(const Type& a) noexcept;
+ };
+
+ template <class Operation, class Operand, class = void> struct fixedCapacityVectorUnaryResult
+ {
+ };
+
+ template <class Operation, class Operand> struct fixedCapacityVectorUnaryResult<Operation, Operand, typename std :: enable_if<fixedCapacityVectorOperand<Operand> :: value> :: type>
+ {
+  typedef fixedCapacityVectorUnaryExpression<Operation, typename fixedCapacityVectorOperand<Operand> :: type> type;
+ };
+
+ template <class Operation, class Left, class Right, class = void> struct fixedCapacityVectorBinaryResult
+ {
+ };
+
+ template <class Operation, class Left, class Right> struct fixedCapacityVectorBinaryResult<Operation, Left, Right, typename fixedCapacityVectorVoid<typename fixedCapacityVectorArgument<Left, typename fixedCapacityVectorFirstOperand<Left, Right> :: value_type> :: type, typename fixedCapacityVectorArgument<Right, typename fixedCapacityVectorFirstOperand<Left, Right> :: value_type> :: type> :: type>
+ {
+  typedef fixedCapacityVectorArgument<Left, typename fixedCapacityVectorFirstOperand<Left, Right> :: value_type> left;
+  typedef fixedCapacityVectorArgument<Right, typename fixedCapacityVectorFirstOperand<Left, Right> :: value_type> right;
+  typedef fixedCapacityVectorBinaryExpression<Operation, typename left :: type, typename right :: type> type;
+ };
+
+ template <class Multiplicand, class Multiplier, class Addend, class = void> struct fixedCapacityVectorFmaResult
+ {
+ };
+
+ template <class Multiplicand, class Multiplier, class Addend> struct fixedCapacityVectorFmaResult<Multiplicand, Multiplier, Addend, typename fixedCapacityVectorVoid<typename fixedCapacityVectorArgument<Multiplicand, typename fixedCapacityVectorFirstOperand<Multiplicand, Multiplier, Addend> :: value_type> :: type, typename fixedCapacityVectorArgument<Multiplier, typename fixedCapacityVectorFirstOperand<Multiplicand, Multiplier, Addend> :: value_type> :: type, typename fixedCapacityVectorArgument<Addend, typename fixedCapacityVectorFirstOperand<Multiplicand, Multiplier, Addend> :: value_type> :: type> :: type>
+ {
+  typedef typename fixedCapacityVectorFirstOperand<Multiplicand, Multiplier, Addend> :: value_type value_type;
+  typedef fixedCapacityVectorArgument<Multiplicand, value_type> multiplicand;
+  typedef fixedCapacityVectorArgument<Multiplier, value_type> multiplier;
+  typedef fixedCapacityVectorArgument<Addend, value_type> addend;
+  typedef fixedCapacityVectorFmaExpression<typename multiplicand :: type, typename multiplier :: type, typename addend :: type> type;
+ };
+
+ template <class Type, std :: size_t Capacity, class Right, class = void> struct fixedCapacityVectorCompoundResult
+ {
+ };
+
+ template <class Type, std :: size_t Capacity, class Right> struct fixedCapacityVectorCompoundResult<Type, Capacity, Right, typename fixedCapacityVectorVoid<typename fixedCapacityVectorArgument<fixedCapacityVector<Type, Capacity>, Type> :: type, typename fixedCapacityVectorArgument<Right, Type> :: type> :: type>
+ {
+  typedef fixedCapacityVectorArgument<Right, Type> right;
+  typedef fixedCapacityVector<Type, Capacity>& type;
+ };
+
+ template <class Left, class Right, class = void> struct fixedCapacityVectorDotResult
+ {
+ };
+
+ template <class Left, class Right> struct fixedCapacityVectorDotResult<Left, Right, typename std :: enable_if<fixedCapacityVectorOperand<Left> :: value && fixedCapacityVectorOperand<Right> :: value> :: type>
+ {
+  typedef typename fixedCapacityVectorOperand<Left> :: value_type type;
+ };
+
+ template <class Operand, class = void> struct fixedCapacityVectorNormResult
+ {
+ };
+
+ template <class Operand> struct fixedCapacityVectorNormResult<Operand, typename std :: enable_if<fixedCapacityVectorOperand<Operand> :: value> :: type>
+ {
+  typedef decltype(std :: sqrt(std :: declval<typename fixedCapacityVectorOperand<Operand> :: value_type>())) type;
+ };
+
+ template <class Left, class Right> SH_MATH_CONSTEXPR20 void fixedCapacityVectorCheckSizes(const Left& a, const Right& b);
+ //Sum over four independent accumulators so the reduction does not serialise on one dependency chain and can be vectorized.
+ template <class Expression> SH_MATH_CONSTEXPR20 typename Expression :: value_type fixedCapacityVectorSum(const Expression& a) noexcept;
+ template <class Operation, class Type, class Expression> SH_MATH_CONSTEXPR20 void fixedCapacityVectorApply(Type* first, std :: size_t n, const Expression& a) noexcept;
+
+ template <class Operand> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorUnaryResult<fixedCapacityVectorNegate, Operand> :: type operator - (const Operand& a);
+ template <class Left, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorBinaryResult<fixedCapacityVectorPlus, Left, Right> :: type operator + (const Left& a, const Right& b);
+ template <class Left, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorBinaryResult<fixedCapacityVectorMinus, Left, Right> :: type operator - (const Left& a, const Right& b);
+ template <class Left, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorBinaryResult<fixedCapacityVectorMultiplies, Left, Right> :: type operator * (const Left& a, const Right& b);
+ template <class Left, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorBinaryResult<fixedCapacityVectorDivides, Left, Right> :: type operator / (const Left& a, const Right& b);
+ template <class Multiplicand, class Multiplier, class Addend> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorFmaResult<Multiplicand, Multiplier, Addend> :: type fma(const Multiplicand& a, const Multiplier& b, const Addend& c);
+ template <class Left, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorDotResult<Left, Right> :: type dot(const Left& a, const Right& b);
+ template <class Operand> typename fixedCapacityVectorNormResult<Operand> :: type norm(const Operand& a);
+
+ //Stores an expression into a; its capacity has to fit Capacity, which is checked at compile time, so a never overflows and a may appear in the expression.
+ template <class Type, std :: size_t Capacity, class Expression> SH_MATH_CONSTEXPR20 void assign(fixedCapacityVector<Type, Capacity>& a, const fixedCapacityVectorExpression<Expression>& b);
+ //In place updates; a vector or expression on the right has to have the size of a, and a scalar is broadcast.
+ template <class Type, std :: size_t Capacity, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: type operator += (fixedCapacityVector<Type, Capacity>& a, const Right& b);
+ template <class Type, std :: size_t Capacity, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: type operator -= (fixedCapacityVector<Type, Capacity>& a, const Right& b);
+ template <class Type, std :: size_t Capacity, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: type operator *= (fixedCapacityVector<Type, Capacity>& a, const Right& b);
+ template <class Type, std :: size_t Capacity, class Right> SH_MATH_CONSTEXPR20 typename fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: type operator /= (fixedCapacityVector<Type, Capacity>& a, const Right& b);
+}
+
+#if (__cplusplus < 201703)
+template <class Type, std :: size_t Capacity> constexpr std :: size_t shMath :: fixedCapacityVectorTerminal <Type, Capacity> :: capacity;
+template <class Type, std :: size_t Capacity> constexpr bool shMath :: fixedCapacityVectorTerminal <Type, Capacity> :: sized;
+template <class Type> constexpr std :: size_t shMath :: fixedCapacityVectorScalar <Type> :: capacity;
+template <class Type> constexpr bool shMath :: fixedCapacityVectorScalar <Type> :: sized;
+template <class Operation, class Operand> constexpr std :: size_t shMath :: fixedCapacityVectorUnaryExpression <Operation, Operand> :: capacity;
+template <class Operation, class Operand> constexpr bool shMath :: fixedCapacityVectorUnaryExpression <Operation, Operand> :: sized;
+template <class Operation, class Left, class Right> constexpr std :: size_t shMath :: fixedCapacityVectorBinaryExpression <Operation, Left, Right> :: capacity;
+template <class Operation, class Left, class Right> constexpr bool shMath :: fixedCapacityVectorBinaryExpression <Operation, Left, Right> :: sized;
+template <class Multiplicand, class Multiplier, class Addend> constexpr std :: size_t shMath :: fixedCapacityVectorFmaExpression <Multiplicand, Multiplier, Addend> :: capacity;
+template <class Multiplicand, class Multiplier, class Addend> constexpr bool shMath :: fixedCapacityVectorFmaExpression <Multiplicand, Multiplier, Addend> :: sized;
+#endif
+
+template <class Derived> SH_MATH_CONSTEXPR20 inline const Derived& shMath :: fixedCapacityVectorExpression <Derived> :: derived() const noexcept
+{
+ return static_cast<const Derived&>(*this);
+}
+
+template <class Derived> template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorExpression <Derived> :: operator shMath :: fixedCapacityVector<Type, Capacity>() const
+{
+ fixedCapacityVector<Type, Capacity> result;
+ assign(result, *this);
+ return result;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorTerminal <Type, Capacity> :: fixedCapacityVectorTerminal(const shMath :: fixedCapacityVector<Type, Capacity>& a) noexcept
+: Data(a.data()), Size(a.size())
+{
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline std :: size_t shMath :: fixedCapacityVectorTerminal <Type, Capacity> :: size() const noexcept
+{
+ return Size;
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline Type shMath :: fixedCapacityVectorTerminal <Type, Capacity> :: operator [] (std :: size_t n) const noexcept
+{
+ return Data[n];
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorScalar <Type> :: fixedCapacityVectorScalar(const Type& value) noexcept
+: Value(value)
+{
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline std :: size_t shMath :: fixedCapacityVectorScalar <Type> :: size() const noexcept
+{
+ return 0u;
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline Type shMath :: fixedCapacityVectorScalar <Type> :: operator [] (std :: size_t) const noexcept
+{
+ return Value;
+}
+
+template <class Operation, class Operand> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorUnaryExpression <Operation, Operand> :: fixedCapacityVectorUnaryExpression(const Operand& a) noexcept
+: A(a)
+{
+}
+
+template <class Operation, class Operand> SH_MATH_CONSTEXPR20 inline std :: size_t shMath :: fixedCapacityVectorUnaryExpression <Operation, Operand> :: size() const noexcept
+{
+ return A.size();
+}
+
+template <class Operation, class Operand> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorUnaryExpression <Operation, Operand> :: value_type shMath :: fixedCapacityVectorUnaryExpression <Operation, Operand> :: operator [] (std :: size_t n) const noexcept
+{
+ return Operation :: apply(A[n]);
+}
+
+template <class Operation, class Left, class Right> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorBinaryExpression <Operation, Left, Right> :: fixedCapacityVectorBinaryExpression(const Left& a, const Right& b)
+: A(a), B(b)
+{
+ fixedCapacityVectorCheckSizes(A, B);
+}
+
+template <class Operation, class Left, class Right> SH_MATH_CONSTEXPR20 inline std :: size_t shMath :: fixedCapacityVectorBinaryExpression <Operation, Left, Right> :: size() const noexcept
+{
+ return Left :: sized ? A.size() : B.size();
+}
+
+template <class Operation, class Left, class Right> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBinaryExpression <Operation, Left, Right> :: value_type shMath :: fixedCapacityVectorBinaryExpression <Operation, Left, Right> :: operator [] (std :: size_t n) const noexcept
+{
+ return Operation :: apply(A[n], B[n]);
+}
+
+template <class Multiplicand, class Multiplier, class Addend> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorFmaExpression <Multiplicand, Multiplier, Addend> :: fixedCapacityVectorFmaExpression(const Multiplicand& a, const Multiplier& b, const Addend& c)
+: A(a), B(b), C(c)
+{
+ fixedCapacityVectorCheckSizes(A, B);
+ fixedCapacityVectorCheckSizes(A, C);
+ fixedCapacityVectorCheckSizes(B, C);
+}
+
+template <class Multiplicand, class Multiplier, class Addend> SH_MATH_CONSTEXPR20 inline std :: size_t shMath :: fixedCapacityVectorFmaExpression <Multiplicand, Multiplier, Addend> :: size() const noexcept
+{
+ return Multiplicand :: sized ? A.size() : (Multiplier :: sized ? B.size() : C.size());
+}
+
+template <class Multiplicand, class Multiplier, class Addend> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorFmaExpression <Multiplicand, Multiplier, Addend> :: value_type shMath :: fixedCapacityVectorFmaExpression <Multiplicand, Multiplier, Addend> :: operator [] (std :: size_t n) const noexcept
+{
+ return static_cast<value_type>(A[n] * B[n] + C[n]);
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline Type shMath :: fixedCapacityVectorPlus :: apply(const Type& a, const Type& b) noexcept
+{
+ return static_cast<Type>(a + b);
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline Type shMath :: fixedCapacityVectorMinus :: apply(const Type& a, const Type& b) noexcept
+{
+ return static_cast<Type>(a - b);
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline Type shMath :: fixedCapacityVectorMultiplies :: apply(const Type& a, const Type& b) noexcept
+{
+ return static_cast<Type>(a * b);
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline Type shMath :: fixedCapacityVectorDivides :: apply(const Type& a, const Type& b) noexcept
+{
+ return static_cast<Type>(a / b);
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline Type shMath :: fixedCapacityVectorNegate :: apply(const Type& a) noexcept
+{
+ return static_cast<Type>(-a);
+}
+
+template <class Type> SH_MATH_CONSTEXPR20 inline Type shMath :: fixedCapacityVectorSquare :: apply(const Type& a) noexcept
+{
+ return static_cast<Type>(a * a);
+}
+
+template <class Type, std :: size_t Capacity> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorOperand <shMath :: fixedCapacityVector<Type, Capacity>, typename std :: enable_if<std :: is_arithmetic<Type> :: value && !std :: is_same<Type, bool> :: value> :: type> :: type shMath :: fixedCapacityVectorOperand <shMath :: fixedCapacityVector<Type, Capacity>, typename std :: enable_if<std :: is_arithmetic<Type> :: value && !std :: is_same<Type, bool> :: value> :: type> :: make(const shMath :: fixedCapacityVector<Type, Capacity>& a) noexcept
+{
+ return type(a);
+}
+
+template <class Expression> SH_MATH_CONSTEXPR20 inline const Expression& shMath :: fixedCapacityVectorOperand <Expression, typename std :: enable_if<std :: is_base_of<shMath :: fixedCapacityVectorExpression<Expression>, Expression> :: value> :: type> :: make(const Expression& a) noexcept
+{
+ return a;
+}
+
+template <class Type, class ValueType> SH_MATH_CONSTEXPR20 inline shMath :: fixedCapacityVectorScalar<ValueType> shMath :: fixedCapacityVectorArgument <Type, ValueType, typename std :: enable_if<!shMath :: fixedCapacityVectorOperand<Type> :: value && shMath :: fixedCapacityVectorNonNarrowing<Type, ValueType> :: value> :: type> :: make(const Type& a) noexcept
+{
+ return fixedCapacityVectorScalar<ValueType>(static_cast<ValueType>(a));
+}
+
+template <class Left, class Right> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVectorCheckSizes(const Left& a, const Right& b)
+{
+ if (Left :: sized && Right :: sized && (a.size() != b.size()))
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+}
+
+template <class Expression> SH_MATH_CONSTEXPR20 typename Expression :: value_type shMath :: fixedCapacityVectorSum(const Expression& a) noexcept
+{
+ typedef typename Expression :: value_type value_type;
+ const std :: size_t n = a.size();
+ value_type sum0 = value_type(), sum1 = value_type(), sum2 = value_type(), sum3 = value_type();
+ std :: size_t i = 0u;
+ for (; n - i >= 4u; i += 4u)
+ {
+  sum0 += a[i];
+  sum1 += a[i + 1u];
+  sum2 += a[i + 2u];
+  sum3 += a[i + 3u];
+ }
+ for (; i != n; ++i)
+ {
+  sum0 += a[i];
+ }
+ return static_cast<value_type>((sum0 + sum1) + (sum2 + sum3));
+}
+
+template <class Operation, class Type, class Expression> SH_MATH_CONSTEXPR20 inline void shMath :: fixedCapacityVectorApply(Type* first, std :: size_t n, const Expression& a) noexcept
+{
+ for (std :: size_t i = 0u; i != n; ++i)
+ {
+  first[i] = Operation :: apply(first[i], a[i]);
+ }
+}
+
+template <class Operand> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorUnaryResult<shMath :: fixedCapacityVectorNegate, Operand> :: type shMath :: operator - (const Operand& a)
+{
+ return typename fixedCapacityVectorUnaryResult<fixedCapacityVectorNegate, Operand> :: type(fixedCapacityVectorOperand<Operand> :: make(a));
+}
+
+template <class Left, class Right> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBinaryResult<shMath :: fixedCapacityVectorPlus, Left, Right> :: type shMath :: operator + (const Left& a, const Right& b)
+{
+ typedef fixedCapacityVectorBinaryResult<fixedCapacityVectorPlus, Left, Right> result;
+ return typename result :: type(result :: left :: make(a), result :: right :: make(b));
+}
+
+template <class Left, class Right> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBinaryResult<shMath :: fixedCapacityVectorMinus, Left, Right> :: type shMath :: operator - (const Left& a, const Right& b)
+{
+ typedef fixedCapacityVectorBinaryResult<fixedCapacityVectorMinus, Left, Right> result;
+ return typename result :: type(result :: left :: make(a), result :: right :: make(b));
+}
+
+template <class Left, class Right> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBinaryResult<shMath :: fixedCapacityVectorMultiplies, Left, Right> :: type shMath :: operator * (const Left& a, const Right& b)
+{
+ typedef fixedCapacityVectorBinaryResult<fixedCapacityVectorMultiplies, Left, Right> result;
+ return typename result :: type(result :: left :: make(a), result :: right :: make(b));
+}
+
+template <class Left, class Right> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorBinaryResult<shMath :: fixedCapacityVectorDivides, Left, Right> :: type shMath :: operator / (const Left& a, const Right& b)
+{
+ typedef fixedCapacityVectorBinaryResult<fixedCapacityVectorDivides, Left, Right> result;
+ return typename result :: type(result :: left :: make(a), result :: right :: make(b));
+}
+
+template <class Multiplicand, class Multiplier, class Addend> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorFmaResult<Multiplicand, Multiplier, Addend> :: type shMath :: fma(const Multiplicand& a, const Multiplier& b, const Addend& c)
+{
+ typedef fixedCapacityVectorFmaResult<Multiplicand, Multiplier, Addend> result;
+ return typename result :: type(result :: multiplicand :: make(a), result :: multiplier :: make(b), result :: addend :: make(c));
+}
+
+template <class Left, class Right> SH_MATH_CONSTEXPR20 inline typename shMath :: fixedCapacityVectorDotResult<Left, Right> :: type shMath :: dot(const Left& a, const Right& b)
+{
+ return fixedCapacityVectorSum(fixedCapacityVectorBinaryExpression<fixedCapacityVectorMultiplies, typename fixedCapacityVectorOperand<Left> :: type, typename fixedCapacityVectorOperand<Right> :: type>(fixedCapacityVectorOperand<Left> :: make(a), fixedCapacityVectorOperand<Right> :: make(b)));
+}
+
+template <class Operand> inline typename shMath :: fixedCapacityVectorNormResult<Operand> :: type shMath :: norm(const Operand& a)
+{
+ return std :: sqrt(fixedCapacityVectorSum(fixedCapacityVectorUnaryExpression<fixedCapacityVectorSquare, typename fixedCapacityVectorOperand<Operand> :: type>(fixedCapacityVectorOperand<Operand> :: make(a))));
+}
+
+template <class Type, std :: size_t Capacity, class Expression> SH_MATH_CONSTEXPR20 void shMath :: assign(shMath :: fixedCapacityVector<Type, Capacity>& a, const shMath :: fixedCapacityVectorExpression<Expression>& b)
+{
+ static_assert(std :: is_same<Type, typename Expression :: value_type> :: value, "A fixedCapacityVector expression can only be stored into a vector of its element type.");
+ static_assert(Expression :: capacity <= Capacity, "The fixedCapacityVector expression may not fit the capacity of the vector it is stored into.");
+ const Expression& expression = b.derived();
+ const std :: size_t n = expression.size();
+ a.resize_default_init(n);
+ Type* first = a.data();
+ for (std :: size_t i = 0u; i != n; ++i)
+ {
+  first[i] = expression[i];
+ }
+}
+
+template <class Type, std :: size_t Capacity, class Right> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: type shMath :: operator += (shMath :: fixedCapacityVector<Type, Capacity>& a, const Right& b)
+{
+ typedef typename fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: right right;
+ const typename right :: type& expression = right :: make(b);
+ fixedCapacityVectorCheckSizes(fixedCapacityVectorTerminal<Type, Capacity>(a), expression);
+ fixedCapacityVectorApply<fixedCapacityVectorPlus>(a.data(), a.size(), expression);
+ return a;
+}
+
+template <class Type, std :: size_t Capacity, class Right> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: type shMath :: operator -= (shMath :: fixedCapacityVector<Type, Capacity>& a, const Right& b)
+{
+ typedef typename fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: right right;
+ const typename right :: type& expression = right :: make(b);
+ fixedCapacityVectorCheckSizes(fixedCapacityVectorTerminal<Type, Capacity>(a), expression);
+ fixedCapacityVectorApply<fixedCapacityVectorMinus>(a.data(), a.size(), expression);
+ return a;
+}
+
+template <class Type, std :: size_t Capacity, class Right> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: type shMath :: operator *= (shMath :: fixedCapacityVector<Type, Capacity>& a, const Right& b)
+{
+ typedef typename fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: right right;
+ const typename right :: type& expression = right :: make(b);
+ fixedCapacityVectorCheckSizes(fixedCapacityVectorTerminal<Type, Capacity>(a), expression);
+ fixedCapacityVectorApply<fixedCapacityVectorMultiplies>(a.data(), a.size(), expression);
+ return a;
+}
+
+template <class Type, std :: size_t Capacity, class Right> SH_MATH_CONSTEXPR20 typename shMath :: fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: type shMath :: operator /= (shMath :: fixedCapacityVector<Type, Capacity>& a, const Right& b)
+{
+ typedef typename fixedCapacityVectorCompoundResult<Type, Capacity, Right> :: right right;
+ const typename right :: type& expression = right :: make(b);
+ fixedCapacityVectorCheckSizes(fixedCapacityVectorTerminal<Type, Capacity>(a), expression);
+ fixedCapacityVectorApply<fixedCapacityVectorDivides>(a.data(), a.size(), expression);
+ return a;
+}
+#endif
+#endif
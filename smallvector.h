@@ -0,0 +1,685 @@
+#ifndef SH_MATH_SMALLVECTOR
+#define SH_MATH_SMALLVECTOR
+
+#include "fixedcapacityvector.h"
+
+#if (__cplusplus < 201103)
+#else
+namespace shMath
+{
+ //Keeps the first InlineCapacity elements in inline storage like fixedCapacityVector and spills to a geometrically grown Allocator buffer past that.
+ //The inline storage and its narrow counter are laid out as in fixedCapacityVector; once spilled the inline storage holds the buffer pointer, size and capacity instead, so it is at least three words long.
+ template <class Type, std :: size_t InlineCapacity, class Allocator = std :: allocator<Type> > class smallVector : private Allocator
+ {
+  static_assert(InlineCapacity > 0u, "smallVector needs room for at least one inline element.");
+  public:
+  typedef Type* pointer;
+  typedef Type& reference;
+  typedef const Type* const_pointer;
+  typedef const Type& const_reference;
+  typedef Type&& rvalue_reference;
+  typedef Type* iterator;
+  typedef const Type* const_iterator;
+  typedef std :: reverse_iterator<iterator> reverse_iterator;
+  typedef std :: reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef std :: size_t size_type;
+  typedef std :: ptrdiff_t difference_type;
+  typedef Type value_type;
+  typedef Allocator allocator_type;
+  smallVector() noexcept(std :: is_nothrow_default_constructible<Allocator>{});
+  explicit smallVector(const allocator_type& alloc) noexcept;
+  explicit smallVector(size_type n, const allocator_type& alloc = allocator_type());
+  smallVector(size_type n, const value_type& val, const allocator_type& alloc = allocator_type());
+  template <class InputIterator, class = typename std :: enable_if<!std :: is_integral<InputIterator> :: value> :: type> smallVector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type());
+  smallVector(std :: initializer_list<value_type> list, const allocator_type& alloc = allocator_type());
+  smallVector(const smallVector& a);
+  smallVector(smallVector&& a) noexcept(std :: is_nothrow_move_constructible<Type>{});
+  ~smallVector();
+  smallVector& operator = (const smallVector& a);
+  smallVector& operator = (smallVector&& a);
+  smallVector& operator = (std :: initializer_list<value_type> list);
+  allocator_type get_allocator() const noexcept;
+  size_type capacity() const noexcept;
+  bool is_inline() const noexcept;
+  pointer data() noexcept;
+  const_pointer data() const noexcept;
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  reverse_iterator rbegin() noexcept;
+  const_reverse_iterator rbegin() const noexcept;
+  reverse_iterator rend() noexcept;
+  const_reverse_iterator rend() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+  const_reverse_iterator crbegin() const noexcept;
+  const_reverse_iterator crend() const noexcept;
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  reference operator [] (size_type n) noexcept;
+  const_reference operator [] (size_type n) const noexcept;
+  reference at(size_type n);
+  const_reference at(size_type n) const;
+  reference front() noexcept;
+  const_reference front() const noexcept;
+  reference back() noexcept;
+  const_reference back() const noexcept;
+  void clear() noexcept(std :: is_nothrow_destructible<Type>{});
+  void pop_back() noexcept(std :: is_nothrow_destructible<Type>{});
+  void push_back(const value_type& val);
+  void push_back(rvalue_reference val);
+  template <class ... Args> reference emplace_back(Args&& ... args);
+  void reserve(size_type n);
+  void resize(size_type n);
+  void resize(size_type n, const value_type& val);
+  //Spilled buffers change hands without touching their elements; only inline elements are moved.
+  void swap(smallVector& a) noexcept(std :: is_nothrow_move_constructible<Type>{} && std :: is_nothrow_move_assignable<Type>{});
+  private:
+  struct heapBuffer
+  {
+   pointer Begin;
+   size_type Size;
+   size_type Reserved;
+  };
+  union storage
+  {
+   typename std :: aligned_storage <sizeof(Type), alignof(Type)> :: type Elements[InlineCapacity];
+   heapBuffer Heap;
+  };
+  pointer inlineData() noexcept;
+  const_pointer inlineData() const noexcept;
+  void setSize(size_type n) noexcept;
+  void grow(size_type n);
+  template <class ... Args> reference emplaceSlow(Args&& ... args);
+  template <class ... Args> reference emplaceSpill(Args&& ... args);
+  void adopt(pointer result, size_type n, size_type reserved) noexcept(std :: is_nothrow_destructible<Type>{});
+  //Copies, or moves when Type cannot be copied; a throw destroys what was built in result and leaves the caller to free it.
+  void relocate(pointer result, std :: integral_constant<bool, false>);
+  void relocate(pointer result, std :: integral_constant<bool, true>) noexcept;
+  void release() noexcept(std :: is_nothrow_destructible<Type>{});
+  void steal(smallVector& a) noexcept(std :: is_nothrow_move_constructible<Type>{});
+  void swapInline(smallVector& a);
+  void swapSpilled(smallVector& a);
+  storage Data;
+  //Number of inline elements, or InlineCapacity + 1 once the elements live in Data.Heap.
+  typename fixedCapacityVectorSizeType<InlineCapacity + 1u> :: type Count;
+ };
+
+ template <class Type, std :: size_t InlineCapacity, class Allocator> void swap(smallVector<Type, InlineCapacity, Allocator>& a, smallVector<Type, InlineCapacity, Allocator>& b) noexcept(noexcept(a.swap(b)));
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline shMath :: smallVector <Type, InlineCapacity, Allocator> :: smallVector() noexcept(std :: is_nothrow_default_constructible<Allocator>{})
+: Allocator(), Count(0u)
+{
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline shMath :: smallVector <Type, InlineCapacity, Allocator> :: smallVector(const typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: allocator_type& alloc) noexcept
+: Allocator(alloc), Count(0u)
+{
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> shMath :: smallVector <Type, InlineCapacity, Allocator> :: smallVector(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n, const typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: allocator_type& alloc)
+: Allocator(alloc), Count(0u)
+{
+ SH_MATH_TRY
+ {
+  resize(n);
+ }
+ SH_MATH_CATCH_ALL
+ {
+  release(); //A throwing constructor never runs the destructor, so a spilled buffer would leak.
+  SH_MATH_RETHROW;
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> shMath :: smallVector <Type, InlineCapacity, Allocator> :: smallVector(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n, const typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: value_type& val, const typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: allocator_type& alloc)
+: Allocator(alloc), Count(0u)
+{
+ SH_MATH_TRY
+ {
+  resize(n, val);
+ }
+ SH_MATH_CATCH_ALL
+ {
+  release();
+  SH_MATH_RETHROW;
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> template <class InputIterator, class> shMath :: smallVector <Type, InlineCapacity, Allocator> :: smallVector(InputIterator first, InputIterator last, const typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: allocator_type& alloc)
+: Allocator(alloc), Count(0u)
+{
+ SH_MATH_TRY
+ {
+  for(;first != last;++first) emplace_back(*first);
+ }
+ SH_MATH_CATCH_ALL
+ {
+  release();
+  SH_MATH_RETHROW;
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> shMath :: smallVector <Type, InlineCapacity, Allocator> :: smallVector(std :: initializer_list<typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: value_type> list, const typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: allocator_type& alloc)
+: Allocator(alloc), Count(0u)
+{
+ SH_MATH_TRY
+ {
+  reserve(list.size());
+  fixedCapacityVectorUninitializedCopy(list.begin(), list.end(), data());
+  setSize(list.size());
+ }
+ SH_MATH_CATCH_ALL
+ {
+  release();
+  SH_MATH_RETHROW;
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> shMath :: smallVector <Type, InlineCapacity, Allocator> :: smallVector(const shMath :: smallVector <Type, InlineCapacity, Allocator>& a)
+: Allocator(std :: allocator_traits<Allocator> :: select_on_container_copy_construction(a.get_allocator())), Count(0u)
+{
+ SH_MATH_TRY
+ {
+  reserve(a.size());
+  fixedCapacityVectorUninitializedCopy(a.begin(), a.end(), data());
+  setSize(a.size());
+ }
+ SH_MATH_CATCH_ALL
+ {
+  release();
+  SH_MATH_RETHROW;
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline shMath :: smallVector <Type, InlineCapacity, Allocator> :: smallVector(shMath :: smallVector <Type, InlineCapacity, Allocator>&& a) noexcept(std :: is_nothrow_move_constructible<Type>{})
+: Allocator(std :: move(static_cast<Allocator&>(a))), Count(0u)
+{
+ steal(a);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline shMath :: smallVector <Type, InlineCapacity, Allocator> :: ~smallVector()
+{
+ release();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> shMath :: smallVector <Type, InlineCapacity, Allocator>& shMath :: smallVector <Type, InlineCapacity, Allocator> :: operator = (const shMath :: smallVector <Type, InlineCapacity, Allocator>& a)
+{
+ if (this != &a)
+ {
+  clear();
+  reserve(a.size());
+  fixedCapacityVectorUninitializedCopy(a.begin(), a.end(), data());
+  setSize(a.size());
+ }
+ return *this;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> shMath :: smallVector <Type, InlineCapacity, Allocator>& shMath :: smallVector <Type, InlineCapacity, Allocator> :: operator = (shMath :: smallVector <Type, InlineCapacity, Allocator>&& a)
+{
+ if (this != &a)
+ {
+  release();
+  Count = 0u;
+  if (std :: allocator_traits<Allocator> :: propagate_on_container_move_assignment :: value)
+  {
+   static_cast<Allocator&>(*this) = std :: move(static_cast<Allocator&>(a));
+  }
+  else if (!a.is_inline() && (get_allocator() != a.get_allocator()))
+  {
+   reserve(a.size()); //This allocator cannot free a's buffer, so the elements move one by one.
+   fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(a.begin()), std :: make_move_iterator(a.end()), data());
+   setSize(a.size());
+   a.clear();
+   return *this;
+  }
+  steal(a);
+ }
+ return *this;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline shMath :: smallVector <Type, InlineCapacity, Allocator>& shMath :: smallVector <Type, InlineCapacity, Allocator> :: operator = (std :: initializer_list<typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: value_type> list)
+{
+ clear();
+ reserve(list.size());
+ fixedCapacityVectorUninitializedCopy(list.begin(), list.end(), data());
+ setSize(list.size());
+ return *this;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: allocator_type shMath :: smallVector <Type, InlineCapacity, Allocator> :: get_allocator() const noexcept
+{
+ return static_cast<const Allocator&>(*this);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type shMath :: smallVector <Type, InlineCapacity, Allocator> :: capacity() const noexcept
+{
+ return is_inline() ? InlineCapacity : Data.Heap.Reserved;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline bool shMath :: smallVector <Type, InlineCapacity, Allocator> :: is_inline() const noexcept
+{
+ return (Count <= InlineCapacity);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: pointer shMath :: smallVector <Type, InlineCapacity, Allocator> :: data() noexcept
+{
+ return is_inline() ? inlineData() : Data.Heap.Begin;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_pointer shMath :: smallVector <Type, InlineCapacity, Allocator> :: data() const noexcept
+{
+ return is_inline() ? inlineData() : Data.Heap.Begin;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: begin() noexcept
+{
+ return data();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: begin() const noexcept
+{
+ return data();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: end() noexcept
+{
+ return is_inline() ? inlineData() + Count : Data.Heap.Begin + Data.Heap.Size;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: end() const noexcept
+{
+ return is_inline() ? inlineData() + Count : Data.Heap.Begin + Data.Heap.Size;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reverse_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: rbegin() noexcept
+{
+ return typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reverse_iterator(end());
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reverse_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: rbegin() const noexcept
+{
+ return typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reverse_iterator(end());
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reverse_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: rend() noexcept
+{
+ return typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reverse_iterator(begin());
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reverse_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: rend() const noexcept
+{
+ return typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reverse_iterator(begin());
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: cbegin() const noexcept
+{
+ return begin();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: cend() const noexcept
+{
+ return end();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reverse_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: crbegin() const noexcept
+{
+ return rbegin();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reverse_iterator shMath :: smallVector <Type, InlineCapacity, Allocator> :: crend() const noexcept
+{
+ return rend();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline bool shMath :: smallVector <Type, InlineCapacity, Allocator> :: empty() const noexcept
+{
+ return (size() == 0u);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type shMath :: smallVector <Type, InlineCapacity, Allocator> :: size() const noexcept
+{
+ return is_inline() ? static_cast<size_type>(Count) : Data.Heap.Size;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: operator [] (typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n) noexcept
+{
+ return *(data() + n);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: operator [] (typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n) const noexcept
+{
+ return *(data() + n);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: at(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n)
+{
+ if (n >= size())
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *(data() + n);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: at(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n) const
+{
+ if (n >= size())
+ {
+  fixedCapacityVectorThrowOutOfRange();
+ }
+ return *(data() + n);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: front() noexcept
+{
+ return *data();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: front() const noexcept
+{
+ return *data();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: back() noexcept
+{
+ return *(end() - 1);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: back() const noexcept
+{
+ return *(end() - 1);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: clear() noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ if (std :: is_trivially_destructible<Type> :: value)
+ {
+  setSize(0u);
+  return;
+ }
+ while (!empty()) pop_back();
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: pop_back() noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ const size_type n = size() - 1u;
+ (data() + n)->~Type();
+ setSize(n);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: push_back(const typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: value_type& val)
+{
+ emplace_back(val);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: push_back(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: rvalue_reference val)
+{
+ emplace_back(std :: move(val));
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> template <class ... Args> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: emplace_back(Args&& ... args)
+{
+ const size_type n = Count;
+ if (n >= InlineCapacity)
+ {
+  return emplaceSlow(std :: forward<Args>(args)...);
+ }
+ Type* const address = inlineData() + n; //The same test and store as fixedCapacityVector :: emplace_back while inline.
+ new (address) Type (std :: forward<Args>(args)...);
+ Count = n + 1u;
+ return *address;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> template <class ... Args> typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: emplaceSlow(Args&& ... args)
+{
+ if (is_inline() || (Data.Heap.Size == Data.Heap.Reserved))
+ {
+  return emplaceSpill(std :: forward<Args>(args)...);
+ }
+ Type* const address = Data.Heap.Begin + Data.Heap.Size;
+ new (address) Type (std :: forward<Args>(args)...);
+ ++Data.Heap.Size;
+ return *address;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> template <class ... Args> typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: reference shMath :: smallVector <Type, InlineCapacity, Allocator> :: emplaceSpill(Args&& ... args)
+{
+ const size_type n = size();
+ const size_type reserved = 2u * capacity();
+ Type* const result = std :: allocator_traits<Allocator> :: allocate(*this, reserved);
+ Type* const address = result + n;
+ SH_MATH_TRY
+ {
+  new (address) Type (std :: forward<Args>(args)...); //Built before relocation, since args may refer to an element of the old buffer.
+  SH_MATH_TRY
+  {
+   relocate(result, std :: integral_constant<bool, std :: is_nothrow_move_constructible<Type> :: value>{});
+  }
+  SH_MATH_CATCH_ALL
+  {
+   address->~Type();
+   SH_MATH_RETHROW;
+  }
+ }
+ SH_MATH_CATCH_ALL
+ {
+  std :: allocator_traits<Allocator> :: deallocate(*this, result, reserved);
+  SH_MATH_RETHROW;
+ }
+ adopt(result, n + 1u, reserved);
+ return *address;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: reserve(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n)
+{
+ if (n > capacity())
+ {
+  grow(n);
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> void shMath :: smallVector <Type, InlineCapacity, Allocator> :: resize(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n)
+{
+ if (n < size())
+ {
+  while (size() != n) pop_back();
+  return;
+ }
+ reserve(n);
+ Type* const initialEnd = end();
+ Type* first = initialEnd;
+ Type* const last = data() + n;
+ SH_MATH_TRY
+ {
+  for(;first != last;++first) new (first) Type();
+ }
+ SH_MATH_CATCH_ALL
+ {
+  while (first != initialEnd) (--first)->~Type();
+  SH_MATH_RETHROW;
+ }
+ setSize(n);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> void shMath :: smallVector <Type, InlineCapacity, Allocator> :: resize(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n, const typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: value_type& val)
+{
+ if (n < size())
+ {
+  while (size() != n) pop_back();
+  return;
+ }
+ if (n > capacity())
+ {
+  const value_type copy(val); //val may live in the buffer that grow() releases.
+  grow(n);
+  fixedCapacityVectorUninitializedFill(end(), data() + n, copy);
+ }
+ else
+ {
+  fixedCapacityVectorUninitializedFill(end(), data() + n, val);
+ }
+ setSize(n);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> void shMath :: smallVector <Type, InlineCapacity, Allocator> :: swap(shMath :: smallVector <Type, InlineCapacity, Allocator>& a) noexcept(std :: is_nothrow_move_constructible<Type>{} && std :: is_nothrow_move_assignable<Type>{})
+{
+ if (this == &a)
+ {
+  return;
+ }
+ if (std :: allocator_traits<Allocator> :: propagate_on_container_swap :: value)
+ {
+  using std :: swap;
+  swap(static_cast<Allocator&>(*this), static_cast<Allocator&>(a));
+ }
+ if (is_inline())
+ {
+  if (a.is_inline())
+  {
+   swapInline(a);
+  }
+  else
+  {
+   a.swapSpilled(*this);
+  }
+ }
+ else
+ {
+  if (a.is_inline())
+  {
+   swapSpilled(a);
+  }
+  else
+  {
+   std :: swap(Data.Heap, a.Data.Heap);
+  }
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: swap(shMath :: smallVector<Type, InlineCapacity, Allocator>& a, shMath :: smallVector<Type, InlineCapacity, Allocator>& b) noexcept(noexcept(a.swap(b)))
+{
+ a.swap(b);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: pointer shMath :: smallVector <Type, InlineCapacity, Allocator> :: inlineData() noexcept
+{
+ return reinterpret_cast<Type*>(Data.Elements);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: const_pointer shMath :: smallVector <Type, InlineCapacity, Allocator> :: inlineData() const noexcept
+{
+ return reinterpret_cast<const Type*>(Data.Elements);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: setSize(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n) noexcept
+{
+ if (is_inline())
+ {
+  Count = n;
+ }
+ else
+ {
+  Data.Heap.Size = n;
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> void shMath :: smallVector <Type, InlineCapacity, Allocator> :: grow(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n)
+{
+ const size_type reserved = std :: max(n, 2u * capacity());
+ Type* const result = std :: allocator_traits<Allocator> :: allocate(*this, reserved);
+ SH_MATH_TRY
+ {
+  relocate(result, std :: integral_constant<bool, std :: is_nothrow_move_constructible<Type> :: value>{});
+ }
+ SH_MATH_CATCH_ALL
+ {
+  std :: allocator_traits<Allocator> :: deallocate(*this, result, reserved);
+  SH_MATH_RETHROW;
+ }
+ adopt(result, size(), reserved);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: adopt(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: pointer result, typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type n, typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: size_type reserved) noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ release();
+ Data.Heap.Begin = result;
+ Data.Heap.Size = n;
+ Data.Heap.Reserved = reserved;
+ Count = InlineCapacity + 1u;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: relocate(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: pointer result, std :: integral_constant<bool, false>)
+{
+ typedef typename std :: conditional<std :: is_copy_constructible<Type> :: value, pointer, std :: move_iterator<pointer> > :: type source;
+ fixedCapacityVectorUninitializedCopy(source(begin()), source(end()), result);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: relocate(typename shMath :: smallVector <Type, InlineCapacity, Allocator> :: pointer result, std :: integral_constant<bool, true>) noexcept
+{
+ fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(begin()), std :: make_move_iterator(end()), result);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> inline void shMath :: smallVector <Type, InlineCapacity, Allocator> :: release() noexcept(std :: is_nothrow_destructible<Type>{})
+{
+ if (is_inline())
+ {
+  clear();
+  return;
+ }
+ const heapBuffer heap = Data.Heap; //Read only once the buffer is known to be spilled, so the inline case never touches the heap description.
+ clear();
+ std :: allocator_traits<Allocator> :: deallocate(*this, heap.Begin, heap.Reserved);
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> void shMath :: smallVector <Type, InlineCapacity, Allocator> :: steal(shMath :: smallVector <Type, InlineCapacity, Allocator>& a) noexcept(std :: is_nothrow_move_constructible<Type>{})
+{
+ if (a.is_inline())
+ {
+  fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(a.inlineData()), std :: make_move_iterator(a.inlineData() + a.Count), inlineData());
+  Count = a.Count;
+  a.clear();
+ }
+ else
+ {
+  Data.Heap = a.Data.Heap; //A spilled buffer changes owner without touching its elements.
+  Count = InlineCapacity + 1u;
+  a.Count = 0u;
+ }
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> void shMath :: smallVector <Type, InlineCapacity, Allocator> :: swapInline(shMath :: smallVector <Type, InlineCapacity, Allocator>& a)
+{
+ shMath :: smallVector <Type, InlineCapacity, Allocator>* shorter = this;
+ shMath :: smallVector <Type, InlineCapacity, Allocator>* longer = &a;
+ if (Count > a.Count)
+ {
+  std :: swap(shorter, longer);
+ }
+ const size_type common = shorter->Count;
+ std :: swap_ranges(shorter->inlineData(), shorter->inlineData() + common, longer->inlineData());
+ fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(longer->inlineData() + common), std :: make_move_iterator(longer->inlineData() + longer->Count), shorter->inlineData() + common);
+ const size_type n = longer->Count;
+ while (longer->Count != common) longer->pop_back();
+ shorter->Count = n;
+}
+
+template <class Type, std :: size_t InlineCapacity, class Allocator> void shMath :: smallVector <Type, InlineCapacity, Allocator> :: swapSpilled(shMath :: smallVector <Type, InlineCapacity, Allocator>& a)
+{
+ const heapBuffer heap = Data.Heap; //The inline elements of a take the place of the buffer description.
+ SH_MATH_TRY
+ {
+  fixedCapacityVectorUninitializedCopy(std :: make_move_iterator(a.inlineData()), std :: make_move_iterator(a.inlineData() + a.Count), inlineData());
+ }
+ SH_MATH_CATCH_ALL
+ {
+  Data.Heap = heap;
+  SH_MATH_RETHROW;
+ }
+ Count = a.Count;
+ a.clear();
+ a.Data.Heap = heap;
+ a.Count = InlineCapacity + 1u;
+}
+#endif
+#endif
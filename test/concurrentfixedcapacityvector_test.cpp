@@ -0,0 +1,144 @@
+#include "concurrentfixedcapacityvector.h"
+#include "shmathtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+ const int producers = 4;
+ const int rounds = 60;
+
+ //Elements have to be nothrow copyable, so each one records where it came from.
+ struct item
+ {
+  int Producer;
+  int Round;
+  int Part;
+ };
+
+ bool operator == (const item& a, const item& b)
+ {
+  return std :: tie(a.Producer, a.Round, a.Part) == std :: tie(b.Producer, b.Round, b.Part);
+ }
+
+ bool operator < (const item& a, const item& b)
+ {
+  return std :: tie(a.Producer, a.Round, a.Part) < std :: tie(b.Producer, b.Round, b.Part);
+ }
+
+ //What producer t appends in round i: one value, or a batch of seven.
+ std :: vector<item> batch(int t, int i)
+ {
+  std :: vector<item> result;
+  const int n = (i % 3 == 0) ? 7 : 1;
+  for(int j = 0;j != n;++j) result.push_back(item{t, i, j});
+  return result;
+ }
+
+ //Several producers against the sorted concatenation of what each of them appended; with room for everything nothing may be lost or duplicated.
+ template <std :: size_t Capacity> void compareWithSerialAppends(int repeats)
+ {
+  static shMath :: concurrentFixedCapacityVector<item, Capacity> a;
+  std :: vector<item> expected;
+  for(int t = 0;t != producers;++t)
+  {
+   for(int i = 0;i != rounds;++i)
+   {
+    const std :: vector<item> values = batch(t, i);
+    expected.insert(expected.end(), values.begin(), values.end());
+   }
+  }
+  std :: sort(expected.begin(), expected.end());
+  for(int repeat = 0;repeat != repeats;++repeat)
+  {
+   std :: vector<std :: thread> threads;
+   for(int t = 0;t != producers;++t)
+   {
+    threads.emplace_back([t]()
+    {
+     for(int i = 0;i != rounds;++i)
+     {
+      const std :: vector<item> values = batch(t, i);
+      switch (i % 3)
+      {
+       case 0:
+       a.try_append(values.data(), values.size());
+       break;
+       case 1:
+       a.try_push_back(values[0]);
+       break;
+       default:
+       {
+        item* first = nullptr;
+        const std :: size_t n = a.try_reserve(1u, first);
+        for(std :: size_t k = 0u;k != n;++k) new (first + k) item(values[k]);
+        a.commit(n);
+       }
+       break;
+      }
+     }
+    });
+   }
+   for (std :: thread& thread : threads) thread.join();
+   a.seal();
+   const std :: size_t kept = std :: min(expected.size(), Capacity);
+   SH_MATH_CHECK((a.size() == kept) && (a.overflow_count() == expected.size() - kept));
+   std :: vector<item> result(a.begin(), a.end());
+   std :: sort(result.begin(), result.end());
+   if (kept == expected.size())
+   {
+    SH_MATH_CHECK(result == expected);
+   }
+   else
+   {
+    SH_MATH_CHECK(std :: includes(expected.begin(), expected.end(), result.begin(), result.end()));
+   }
+   a.clear();
+   SH_MATH_CHECK(a.empty() && (a.overflow_count() == 0u));
+  }
+ }
+
+ void checkOverflow()
+ {
+  shMath :: concurrentFixedCapacityVector<int, 10> a;
+  const int values[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  SH_MATH_CHECK((a.try_append(values, 8u) == 8u) && (a.try_append(values, 8u) == 2u) && (a.overflow_count() == 6u));
+  SH_MATH_CHECK(!a.try_push_back(9) && !a.try_emplace_back(9) && (a.overflow_count() == 8u));
+  int* first = nullptr;
+  SH_MATH_CHECK((a.try_reserve(3u, first) == 0u) && (first == nullptr));
+  SH_MATH_CHECK(a.empty());
+  a.seal();
+  SH_MATH_CHECK((a.size() == 10u) && (a[9] == 2) && (a.at(8) == 1));
+  SH_MATH_CHECK_THROWS(std :: out_of_range, a.at(10u));
+ }
+
+ //Elements that were never sealed are still destroyed, which LeakSanitizer checks for heap buffers.
+ void checkUnsealed()
+ {
+  shMath :: concurrentFixedCapacityVector<std :: string, 4> a;
+  SH_MATH_CHECK(a.try_emplace_back(std :: string(100u, 'a')) && a.try_push_back(std :: string(200u, 'b')));
+  SH_MATH_CHECK(a.size() == 0u);
+  a.clear();
+  SH_MATH_CHECK(a.try_emplace_back(std :: string(300u, 'c')));
+  a.seal();
+  SH_MATH_CHECK((a.size() == 1u) && (a[0].size() == 300u));
+  shMath :: concurrentFixedCapacityVector<std :: string, 4> b;
+  SH_MATH_CHECK(b.try_emplace_back(std :: string(400u, 'd')));
+ }
+}
+
+int main()
+{
+ compareWithSerialAppends<1000>(20);
+ compareWithSerialAppends<300>(20);
+ checkOverflow();
+ checkUnsealed();
+ return 0;
+}
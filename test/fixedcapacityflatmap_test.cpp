@@ -0,0 +1,298 @@
+#include "fixedcapacityflatmap.h"
+#include "shmathtest.h"
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <new>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+ using shMathTest :: below;
+ using shMathTest :: value;
+
+ template <class Map, class Reference> void checkSame(const Map& a, const Reference& b)
+ {
+  SH_MATH_CHECK((a.size() == b.size()) && (a.empty() == b.empty()) && (a.values().size() == b.size()));
+  std :: size_t n = 0u;
+  for (const auto& item : b)
+  {
+   SH_MATH_CHECK((a.key_at(n) == item.first) && (a.value_at(n) == item.second) && (a.index_of(item.first) == n));
+   SH_MATH_CHECK((a.find(item.first) != nullptr) && (*a.find(item.first) == item.second));
+   ++n;
+  }
+ }
+
+ //Random map operations against std :: map, keeping within Capacity.
+ template <class Value, std :: size_t Capacity> void compareWithMap(std :: size_t steps)
+ {
+  typedef shMath :: fixedCapacityFlatMap<int, Value, Capacity> map;
+  map a;
+  std :: map<int, Value> b;
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const int key = static_cast<int>(below(2u * Capacity));
+   const Value val = value<Value>();
+   const bool room = (b.size() != Capacity) || (b.count(key) != 0u);
+   switch (below(7u))
+   {
+    case 0u:
+    if (room)
+    {
+     const std :: pair<Value*, bool> result = a.insert(std :: make_pair(key, val));
+     SH_MATH_CHECK(result.second == b.insert(std :: make_pair(key, val)).second);
+     SH_MATH_CHECK(*result.first == b[key]);
+    }
+    break;
+    case 1u:
+    if (room)
+    {
+     SH_MATH_CHECK(a.try_emplace(key, val).second == b.emplace(key, val).second);
+    }
+    break;
+    case 2u:
+    if (room)
+    {
+     SH_MATH_CHECK(a.insert_or_assign(key, val).second == (b.count(key) == 0u));
+     b[key] = val;
+    }
+    break;
+    case 3u:
+    if (room)
+    {
+     a[key] = val;
+     b[key] = val;
+    }
+    break;
+    case 4u:
+    SH_MATH_CHECK(a.erase(key) == b.erase(key));
+    break;
+    case 5u:
+    if (!b.empty())
+    {
+     const std :: size_t n = below(b.size());
+     a.erase_at(n);
+     b.erase(std :: next(b.begin(), static_cast<std :: ptrdiff_t>(n)));
+    }
+    break;
+    case 6u:
+    {
+     const map copy(a);
+     checkSame(copy, b);
+     if (below(16u) == 0u)
+     {
+      a.clear();
+      b.clear();
+     }
+    }
+    break;
+   }
+   checkSame(a, b);
+   SH_MATH_CHECK((a.contains(key) == (b.count(key) != 0u)) && (a.count(key) == b.count(key)));
+   if (b.count(key) == 0u)
+   {
+    SH_MATH_CHECK((a.find(key) == nullptr) && (a.index_of(key) == a.size()));
+    SH_MATH_CHECK_THROWS(std :: out_of_range, a.at(key));
+   }
+  }
+ }
+
+ //Bulk construction keeps the first of equal keys, and only distinct keys count against Capacity.
+ template <class Value, std :: size_t Capacity> void compareBulkWithMap(std :: size_t rounds)
+ {
+  typedef shMath :: fixedCapacityFlatMap<int, Value, Capacity> map;
+  for(std :: size_t round = 0u;round != rounds;++round)
+  {
+   std :: vector<std :: pair<int, Value> > in;
+   std :: map<int, Value> b;
+   const std :: size_t n = below(4u * Capacity);
+   for(std :: size_t i = 0u;i != n;++i)
+   {
+    in.push_back(std :: make_pair(static_cast<int>(below(Capacity + 2u)), value<Value>()));
+    b.insert(in.back());
+   }
+   if (b.size() > Capacity)
+   {
+    SH_MATH_CHECK_THROWS(std :: bad_alloc, map a(in.begin(), in.end()));
+    continue;
+   }
+   const map a(in.begin(), in.end());
+   checkSame(a, b);
+  }
+ }
+
+ //Far more pairs than Capacity, keys in random order: the map fills and sorts early, and must still keep the first value of each key.
+ template <std :: size_t Capacity> void checkManyDuplicates(std :: size_t n)
+ {
+  std :: vector<std :: pair<int, int> > in;
+  std :: vector<int> keys;
+  std :: map<int, int> b;
+  for(std :: size_t i = 0u;i != n;++i)
+  {
+   in.push_back(std :: make_pair(static_cast<int>(below(Capacity)) * 7 - 30, static_cast<int>(i)));
+   keys.push_back(in.back().first);
+   b.insert(in.back());
+  }
+  const shMath :: fixedCapacityFlatMap<int, int, Capacity> a(in.begin(), in.end());
+  checkSame(a, b);
+  const shMath :: fixedCapacityFlatSet<int, Capacity> c(keys.begin(), keys.end());
+  SH_MATH_CHECK((c.size() == b.size()) && std :: equal(c.begin(), c.end(), a.keys().begin()));
+  in.push_back(std :: make_pair(1000, 0));
+  keys.push_back(1000);
+  if (b.size() == Capacity)
+  {
+   SH_MATH_CHECK_THROWS(std :: bad_alloc, (shMath :: fixedCapacityFlatMap<int, int, Capacity>(in.begin(), in.end())));
+   SH_MATH_CHECK_THROWS(std :: bad_alloc, (shMath :: fixedCapacityFlatSet<int, Capacity>(keys.begin(), keys.end())));
+  }
+ }
+
+ void checkBulkMoves()
+ {
+  std :: vector<std :: pair<std :: string, std :: unique_ptr<int> > > in;
+  in.emplace_back("b", std :: unique_ptr<int>(new int(2)));
+  in.emplace_back("a", std :: unique_ptr<int>(new int(1)));
+  in.emplace_back("b", std :: unique_ptr<int>(new int(3)));
+  const shMath :: fixedCapacityFlatMap<std :: string, std :: unique_ptr<int>, 2> a(std :: make_move_iterator(in.begin()), std :: make_move_iterator(in.end()));
+  SH_MATH_CHECK((a.size() == 2u) && (*a.at("a") == 1) && (*a.at("b") == 2));
+  SH_MATH_CHECK((in[0].second == nullptr) && (in[1].second == nullptr) && (in[2].second != nullptr));
+ }
+
+ //Random set operations against std :: set.
+ template <std :: size_t Capacity> void compareWithSet(std :: size_t steps)
+ {
+  typedef shMath :: fixedCapacityFlatSet<int, Capacity> set;
+  set a;
+  std :: set<int> b;
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const int key = static_cast<int>(below(2u * Capacity));
+   switch (below(5u))
+   {
+    case 0u:
+    if ((b.size() != Capacity) || (b.count(key) != 0u))
+    {
+     SH_MATH_CHECK(a.insert(key).second == b.insert(key).second);
+    }
+    break;
+    case 1u:
+    if ((b.size() != Capacity) || (b.count(key) != 0u))
+    {
+     SH_MATH_CHECK(*a.emplace(key).first == key);
+     b.insert(key);
+    }
+    break;
+    case 2u:
+    SH_MATH_CHECK(a.erase(key) == b.erase(key));
+    break;
+    case 3u:
+    if (!b.empty())
+    {
+     const std :: size_t n = below(b.size());
+     SH_MATH_CHECK(a.erase(a.begin() + n) == a.begin() + n);
+     b.erase(std :: next(b.begin(), static_cast<std :: ptrdiff_t>(n)));
+    }
+    break;
+    case 4u:
+    {
+     std :: vector<int> in;
+     std :: set<int> expected;
+     const std :: size_t n = below(4u * Capacity);
+     for(std :: size_t i = 0u;i != n;++i)
+     {
+      in.push_back(static_cast<int>(below(Capacity + 2u)));
+      expected.insert(in.back());
+     }
+     if (expected.size() > Capacity)
+     {
+      SH_MATH_CHECK_THROWS(std :: bad_alloc, set c(in.begin(), in.end()));
+     }
+     else
+     {
+      a = set(in.begin(), in.end());
+      b = expected;
+     }
+    }
+    break;
+   }
+   SH_MATH_CHECK((a.size() == b.size()) && std :: equal(b.begin(), b.end(), a.begin()));
+   SH_MATH_CHECK((a.contains(key) == (b.count(key) != 0u)) && (a.count(key) == b.count(key)));
+   SH_MATH_CHECK((a.lower_bound(key) - a.begin() == std :: distance(b.begin(), b.lower_bound(key))) && (a.upper_bound(key) - a.begin() == std :: distance(b.begin(), b.upper_bound(key))));
+   SH_MATH_CHECK((a.find(key) == a.end()) == (b.find(key) == b.end()));
+  }
+ }
+
+ //Bool keys are stored one per element like bool values, so both containers hand out plain pointers to them.
+ template <class Value> void compareBoolKeys(std :: size_t steps)
+ {
+  shMath :: fixedCapacityFlatMap<bool, Value, 2> a;
+  shMath :: fixedCapacityFlatSet<bool, 2> c;
+  std :: map<bool, Value> b;
+  std :: set<bool> d;
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const bool key = (below(2u) != 0u);
+   const Value val = value<Value>();
+   switch (below(4u))
+   {
+    case 0u:
+    SH_MATH_CHECK(a.insert(std :: make_pair(key, val)).second == b.insert(std :: make_pair(key, val)).second);
+    SH_MATH_CHECK(*c.insert(key).first == key);
+    d.insert(key);
+    break;
+    case 1u:
+    a[key] = val;
+    b[key] = val;
+    break;
+    case 2u:
+    SH_MATH_CHECK((a.erase(key) == b.erase(key)) && (c.erase(key) == d.erase(key)));
+    break;
+    case 3u:
+    {
+     std :: vector<std :: pair<bool, Value> > in;
+     const std :: size_t n = below(8u);
+     b.clear();
+     d.clear();
+     for(std :: size_t i = 0u;i != n;++i)
+     {
+      in.push_back(std :: make_pair(below(2u) != 0u, value<Value>()));
+      b.insert(in.back());
+      d.insert(in.back().first);
+     }
+     a = shMath :: fixedCapacityFlatMap<bool, Value, 2>(in.begin(), in.end());
+     std :: vector<bool> keys;
+     for (const auto& item : in) keys.push_back(item.first);
+     c = shMath :: fixedCapacityFlatSet<bool, 2>(keys.begin(), keys.end());
+    }
+    break;
+   }
+   checkSame(a, b);
+   SH_MATH_CHECK((c.size() == d.size()) && std :: equal(d.begin(), d.end(), c.begin()) && (c.contains(key) == (d.count(key) != 0u)));
+   SH_MATH_CHECK((a.keys().data() == &a.key_at(0u)) && (c.keys().data() == c.begin()));
+  }
+ }
+}
+
+int main()
+{
+ compareWithMap<int, 8>(50000u);
+ compareWithMap<std :: string, 16>(50000u);
+ compareWithMap<bool, 12>(50000u);
+ compareBulkWithMap<int, 4>(5000u);
+ compareBulkWithMap<std :: string, 8>(5000u);
+ compareBulkWithMap<bool, 8>(5000u);
+ checkManyDuplicates<16>(100000u);
+ checkManyDuplicates<64>(100000u);
+ checkManyDuplicates<64>(40u);
+ checkBulkMoves();
+ compareWithSet<4>(20000u);
+ compareWithSet<16>(50000u);
+ compareBoolKeys<int>(20000u);
+ compareBoolKeys<bool>(20000u);
+ return 0;
+}
@@ -0,0 +1,112 @@
+#include "fixedcapacityheap.h"
+#include "shmathtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace
+{
+ using shMathTest :: below;
+ using shMathTest :: value;
+
+ //push and pop against std :: priority_queue.
+ template <class Type, std :: size_t Capacity, class Compare> void compareWithPriorityQueue(std :: size_t steps)
+ {
+  shMath :: fixedCapacityHeap<Type, Capacity, Compare> a;
+  std :: priority_queue<Type, std :: vector<Type>, Compare> b;
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   switch (below(3u))
+   {
+    case 0u:
+    case 1u:
+    if (b.size() != Capacity)
+    {
+     const Type val = value<Type>();
+     a.push(val);
+     b.push(val);
+    }
+    else
+    {
+     SH_MATH_CHECK_THROWS(std :: bad_alloc, a.push(value<Type>()));
+    }
+    break;
+    case 2u:
+    if (!b.empty())
+    {
+     a.pop();
+     b.pop();
+    }
+    break;
+   }
+   SH_MATH_CHECK((a.size() == b.size()) && (a.full() == (b.size() == Capacity)));
+   SH_MATH_CHECK(std :: is_heap(a.container().begin(), a.container().end(), Compare()));
+   if (!b.empty())
+   {
+    SH_MATH_CHECK(a.top() == b.top());
+   }
+  }
+ }
+
+ //offer keeps the Capacity least elements under Compare, which sorting the whole input finds as well.
+ template <class Type, std :: size_t Capacity, class Compare> void compareTopK(std :: size_t rounds)
+ {
+  for(std :: size_t round = 0u;round != rounds;++round)
+  {
+   shMath :: fixedCapacityHeap<Type, Capacity, Compare> a;
+   std :: vector<Type> in;
+   const std :: size_t n = below(4u * Capacity);
+   for(std :: size_t i = 0u;i != n;++i) in.push_back(value<Type>());
+   const std :: size_t split = below(n + 1u);
+   for(std :: size_t i = 0u;i != split;++i) a.offer(in[i]);
+   a.offer(in.begin() + static_cast<std :: ptrdiff_t>(split), in.end());
+   std :: vector<Type> expected(in);
+   std :: sort(expected.begin(), expected.end(), Compare());
+   expected.resize(std :: min(expected.size(), Capacity));
+   SH_MATH_CHECK(a.size() == expected.size());
+   if (!expected.empty())
+   {
+    SH_MATH_CHECK(a.top() == expected.back());
+   }
+   if (below(2u) == 0u)
+   {
+    const typename shMath :: fixedCapacityHeap<Type, Capacity, Compare> :: container_type drained = a.sorted_drain();
+    SH_MATH_CHECK((drained.size() == expected.size()) && std :: equal(expected.begin(), expected.end(), drained.begin()));
+   }
+   else
+   {
+    std :: vector<Type> drained;
+    a.sorted_drain(std :: back_inserter(drained));
+    SH_MATH_CHECK(drained == expected);
+   }
+   SH_MATH_CHECK(a.empty());
+  }
+ }
+
+ struct byMagnitude
+ {
+  bool operator () (int a, int b) const { return std :: abs(a) < std :: abs(b); }
+ };
+}
+
+int main()
+{
+ compareWithPriorityQueue<int, 1, std :: less<int> >(5000u);
+ compareWithPriorityQueue<int, 10, std :: less<int> >(50000u);
+ compareWithPriorityQueue<std :: string, 7, std :: greater<std :: string> >(50000u);
+ compareTopK<int, 1, std :: less<int> >(2000u);
+ compareTopK<int, 10, std :: less<int> >(5000u);
+ compareTopK<int, 7, std :: greater<int> >(5000u);
+ compareTopK<std :: string, 5, std :: greater<std :: string> >(5000u);
+ shMath :: fixedCapacityHeap<int, 2, byMagnitude> magnitudes;
+ const int in[] = {-5, 1, -2, 8};
+ SH_MATH_CHECK((magnitudes.offer(in, in + 4) == 3u) && (magnitudes.top() == -2));
+ return 0;
+}
@@ -0,0 +1,132 @@
+#include "fixedcapacityring.h"
+#include "shmathtest.h"
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+ using shMathTest :: below;
+ using shMathTest :: value;
+
+ //Single threaded against std :: deque, so every wrap position of the indices is reached.
+ template <std :: size_t Capacity> void compareWithDeque(std :: size_t steps)
+ {
+  shMath :: fixedCapacityRing<std :: string, Capacity> a;
+  std :: deque<std :: string> b;
+  std :: vector<std :: string> buffer(Capacity + 2u);
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   switch (below(5u))
+   {
+    case 0u:
+    {
+     const std :: string val = value<std :: string>();
+     SH_MATH_CHECK(a.try_push(val) == (b.size() != Capacity));
+     if (b.size() != Capacity) b.push_back(val);
+    }
+    break;
+    case 1u:
+    {
+     const bool room = (b.size() != Capacity);
+     SH_MATH_CHECK(a.try_emplace(3u, 'x') == room);
+     if (room) b.push_back(std :: string(3u, 'x'));
+    }
+    break;
+    case 2u:
+    {
+     const std :: size_t n = below(Capacity + 2u);
+     for(std :: size_t i = 0u;i != n;++i) buffer[i] = value<std :: string>();
+     const std :: size_t pushed = a.try_push_n(buffer.data(), n);
+     SH_MATH_CHECK(pushed == std :: min(n, Capacity - b.size()));
+     b.insert(b.end(), buffer.begin(), buffer.begin() + static_cast<std :: ptrdiff_t>(pushed));
+    }
+    break;
+    case 3u:
+    {
+     std :: string val;
+     SH_MATH_CHECK(a.try_pop(val) == !b.empty());
+     if (!b.empty())
+     {
+      SH_MATH_CHECK(val == b.front());
+      b.pop_front();
+     }
+    }
+    break;
+    case 4u:
+    {
+     const std :: size_t n = below(Capacity + 2u);
+     const std :: size_t popped = a.try_pop_n(buffer.data(), n);
+     SH_MATH_CHECK(popped == std :: min(n, b.size()));
+     for(std :: size_t i = 0u;i != popped;++i)
+     {
+      SH_MATH_CHECK(buffer[i] == b.front());
+      b.pop_front();
+     }
+    }
+    break;
+   }
+   SH_MATH_CHECK((a.size() == b.size()) && (a.empty() == b.empty()));
+  }
+ }
+
+ //One producer and one consumer; the consumer has to see every value once and in order.
+ template <std :: size_t Capacity> void checkProducerConsumer(int total)
+ {
+  shMath :: fixedCapacityRing<std :: string, Capacity> ring;
+  std :: thread producer([&ring, total]()
+  {
+   std :: vector<std :: string> batch;
+   for(int i = 0;i < total;)
+   {
+    std :: size_t pushed = 0u;
+    if (i % 3 == 0)
+    {
+     batch.clear();
+     for(int k = 0;(k != 5) && (i + k < total);++k) batch.push_back(std :: to_string(i + k));
+     pushed = ring.try_push_n(batch.data(), batch.size());
+    }
+    else
+    {
+     pushed = ring.try_push(std :: to_string(i)) ? 1u : 0u;
+    }
+    if (pushed == 0u)
+    {
+     std :: this_thread :: yield();
+    }
+    i += static_cast<int>(pushed);
+   }
+  });
+  std :: string buffer[4];
+  for(int expected = 0;expected < total;)
+  {
+   const std :: size_t n = ring.try_pop_n(buffer, 1u + static_cast<std :: size_t>(expected) % 4u);
+   if (n == 0u)
+   {
+    std :: this_thread :: yield();
+   }
+   for(std :: size_t k = 0u;k != n;++k)
+   {
+    SH_MATH_CHECK(buffer[k] == std :: to_string(expected));
+    ++expected;
+   }
+  }
+  producer.join();
+  SH_MATH_CHECK(ring.empty());
+ }
+}
+
+int main()
+{
+ compareWithDeque<1>(20000u);
+ compareWithDeque<7>(50000u);
+ compareWithDeque<8>(50000u);
+ checkProducerConsumer<1>(20000);
+ checkProducerConsumer<7>(100000);
+ checkProducerConsumer<8>(100000);
+ checkProducerConsumer<100>(100000);
+ return 0;
+}
@@ -0,0 +1,180 @@
+#include "fixedcapacityslotmap.h"
+#include "shmathtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+ using shMathTest :: below;
+ using shMathTest :: value;
+
+ typedef shMath :: fixedCapacitySlotMapHandle handle;
+
+ struct handleLess
+ {
+  bool operator () (const handle& a, const handle& b) const { return (a.Index < b.Index) || ((a.Index == b.Index) && (a.Generation < b.Generation)); }
+ };
+
+ typedef std :: map<handle, std :: string, handleLess> reference;
+
+ //Every live handle finds its element, every erased one stays stale, and the dense array holds exactly the live elements.
+ template <class SlotMap> void checkSame(const SlotMap& a, const reference& b, const std :: vector<handle>& erased)
+ {
+  SH_MATH_CHECK((a.size() == b.size()) && (a.empty() == b.empty()));
+  for (const auto& item : b)
+  {
+   SH_MATH_CHECK(a.contains(item.first) && (a[item.first] == item.second) && (a.at(item.first) == item.second));
+  }
+  for (const handle& h : erased)
+  {
+   SH_MATH_CHECK(!a.contains(h) && (a.find(h) == nullptr));
+  }
+  std :: vector<std :: string> dense(a.begin(), a.end());
+  std :: vector<std :: string> expected;
+  for (const auto& item : b) expected.push_back(item.second);
+  std :: sort(dense.begin(), dense.end());
+  std :: sort(expected.begin(), expected.end());
+  SH_MATH_CHECK(dense == expected);
+  for (auto it = a.begin();it != a.end();++it) SH_MATH_CHECK(a[a.handle_of(it)] == *it);
+ }
+
+ template <std :: size_t Capacity> void compareWithMap(std :: size_t steps)
+ {
+  typedef shMath :: fixedCapacitySlotMap<std :: string, Capacity> slotMap;
+  slotMap a;
+  reference b;
+  std :: vector<handle> erased;
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const std :: string val = value<std :: string>();
+   switch (below(8u))
+   {
+    case 0u:
+    case 1u:
+    if (b.size() != Capacity)
+    {
+     const handle h = (below(2u) == 0u) ? a.insert(val) : a.emplace(val);
+     SH_MATH_CHECK(b.insert(std :: make_pair(h, val)).second);
+    }
+    else
+    {
+     SH_MATH_CHECK_THROWS(std :: bad_alloc, a.insert(val));
+     SH_MATH_CHECK(a.try_emplace(val) == handle());
+    }
+    break;
+    case 2u:
+    case 3u:
+    if (!b.empty())
+    {
+     const auto it = std :: next(b.begin(), static_cast<std :: ptrdiff_t>(below(b.size())));
+     SH_MATH_CHECK(a.erase(it->first) && !a.erase(it->first));
+     erased.push_back(it->first);
+     b.erase(it);
+    }
+    break;
+    case 4u:
+    if (!b.empty())
+    {
+     const std :: size_t n = below(b.size());
+     const handle h = a.handle_of(a.begin() + n);
+     a.erase(a.cbegin() + n);
+     erased.push_back(h);
+     SH_MATH_CHECK(b.erase(h) == 1u);
+    }
+    break;
+    case 5u:
+    {
+     slotMap copy(a);
+     checkSame(copy, b, erased);
+     slotMap moved(std :: move(copy));
+     checkSame(moved, b, erased);
+     a = moved;
+    }
+    break;
+    case 6u:
+    {
+     slotMap other;
+     other.insert(val);
+     other = a;
+     checkSame(other, b, erased);
+     a = std :: move(other);
+    }
+    break;
+    case 7u:
+    if (below(16u) == 0u)
+    {
+     for (const auto& item : b) erased.push_back(item.first);
+     a.clear();
+     b.clear();
+    }
+    break;
+   }
+   if (erased.size() > 4u * Capacity)
+   {
+    erased.erase(erased.begin(), erased.begin() + static_cast<std :: ptrdiff_t>(erased.size() / 2u));
+   }
+   checkSame(a, b, erased);
+  }
+  SH_MATH_CHECK_THROWS(std :: out_of_range, a.at(handle()));
+ }
+
+ int copiesLeft = -1;
+
+ struct throwingCopy
+ {
+  std :: string Payload;
+  explicit throwingCopy(const std :: string& val) : Payload(val) {}
+  throwingCopy(const throwingCopy& a) : Payload(a.Payload)
+  {
+   if (copiesLeft-- == 0)
+   {
+    throw std :: runtime_error("copy");
+   }
+  }
+  throwingCopy(throwingCopy&& a) noexcept : Payload(std :: move(a.Payload)) {}
+  throwingCopy& operator = (const throwingCopy& a) = default;
+  throwingCopy& operator = (throwingCopy&& a) noexcept = default;
+ };
+
+ //A copy that fails part way leaves the target empty, and none of its old handles may come back to life.
+ void checkThrowingAssignment()
+ {
+  typedef shMath :: fixedCapacitySlotMap<throwingCopy, 4> slotMap;
+  slotMap source;
+  source.emplace("a");
+  source.emplace("b");
+  source.emplace("c");
+  for(int n = 0;n != 3;++n)
+  {
+   slotMap target;
+   const handle old = target.emplace("old");
+   target.erase(old);
+   const handle kept = target.emplace("kept");
+   copiesLeft = n;
+   SH_MATH_CHECK_THROWS(std :: runtime_error, target = source);
+   copiesLeft = -1;
+   SH_MATH_CHECK(target.empty() && !target.contains(old) && !target.contains(kept));
+   const handle fresh = target.emplace("fresh");
+   SH_MATH_CHECK(target.contains(fresh) && !target.contains(old) && !target.contains(kept) && (target[fresh].Payload == "fresh"));
+   copiesLeft = n;
+   SH_MATH_CHECK_THROWS(std :: runtime_error, slotMap copy(source));
+   copiesLeft = -1;
+  }
+ }
+}
+
+int main()
+{
+ compareWithMap<1>(2000u);
+ compareWithMap<8>(30000u);
+ compareWithMap<64>(30000u);
+ checkThrowingAssignment();
+ return 0;
+}
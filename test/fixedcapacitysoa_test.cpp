@@ -0,0 +1,105 @@
+#include "fixedcapacitysoa.h"
+#include "shmathtest.h"
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+static_assert(sizeof(shMath :: fixedCapacitySoA<4, float, double>) == 3u * SH_MATH_CACHE_LINE_SIZE, "Each column of fixedCapacitySoA should take its own cache line, followed by the counter.");
+static_assert(std :: is_nothrow_move_constructible<shMath :: fixedCapacitySoA<4, int, float> > :: value, "fixedCapacitySoA of nothrow movable fields should be nothrow movable.");
+
+namespace
+{
+ using shMathTest :: below;
+ using shMathTest :: value;
+
+ template <class Table> void checkSame(const Table& a, const std :: vector<std :: tuple<int, std :: string> >& b)
+ {
+  SH_MATH_CHECK((a.size() == b.size()) && (a.empty() == b.empty()));
+  for(std :: size_t i = 0u;i != b.size();++i)
+  {
+   SH_MATH_CHECK(a[i] == b[i]);
+   SH_MATH_CHECK((a.template get<0>(i) == std :: get<0>(b[i])) && (a.template data<1>()[i] == std :: get<1>(b[i])));
+  }
+ }
+
+ //Rows of the structure of arrays against a std :: vector of tuples.
+ void compareWithVector(std :: size_t steps)
+ {
+  typedef shMath :: fixedCapacitySoA<16, int, std :: string> table;
+  typedef std :: tuple<int, std :: string> row;
+  table a[2];
+  std :: vector<row> b[2];
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const std :: size_t i = below(2u);
+   table& t = a[i];
+   std :: vector<row>& r = b[i];
+   const row val(value<int>(), value<std :: string>());
+   switch (below(7u))
+   {
+    case 0u:
+    if (r.size() != 16u)
+    {
+     t.push_back(val);
+     r.push_back(val);
+    }
+    break;
+    case 1u:
+    if (r.size() != 16u)
+    {
+     t.emplace_back(std :: get<0>(val), std :: get<1>(val));
+     r.push_back(val);
+    }
+    break;
+    case 2u:
+    if (!r.empty())
+    {
+     SH_MATH_CHECK(t.back() == r.back());
+     t.pop_back();
+     r.pop_back();
+    }
+    break;
+    case 3u:
+    a[1u - i] = t;
+    b[1u - i] = r;
+    break;
+    case 4u:
+    a[1u - i] = std :: move(t);
+    b[1u - i] = std :: move(r);
+    t.clear();
+    r.clear();
+    break;
+    case 5u:
+    {
+     table copy(t);
+     const table moved(std :: move(copy));
+     checkSame(moved, r);
+    }
+    break;
+    case 6u:
+    if (below(8u) == 0u)
+    {
+     t.clear();
+     r.clear();
+    }
+    break;
+   }
+   checkSame(t, r);
+  }
+  SH_MATH_CHECK_THROWS(std :: out_of_range, a[0].at(a[0].size()));
+  while (a[0].size() != 16u) a[0].emplace_back(1, "x");
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, a[0].emplace_back(2, "y"));
+ }
+}
+
+int main()
+{
+ compareWithVector(20000u);
+ return 0;
+}
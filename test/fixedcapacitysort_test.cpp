@@ -0,0 +1,108 @@
+#include "fixedcapacitysort.h"
+#include "shmathtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+static_assert(shMath :: fixedCapacitySortUsesNetwork<int, 32, std :: less<int>, true> :: value, "Stable integer sorts up to the network capacity should use the networks.");
+static_assert(!shMath :: fixedCapacitySortUsesNetwork<int, 33, std :: less<int>, false> :: value, "Capacities past the network capacity should fall back to std :: sort.");
+static_assert(!shMath :: fixedCapacitySortUsesNetwork<float, 8, std :: less<float>, true> :: value, "Stable floating point sorts should fall back to std :: stable_sort.");
+static_assert(shMath :: fixedCapacitySortUsesNetwork<float, 8, std :: greater<float>, false> :: value && shMath :: fixedCapacitySortUsesNetwork<int, 8, std :: greater<>, true> :: value, "std :: greater should use the networks too.");
+
+namespace
+{
+ using shMathTest :: below;
+
+ //Every algorithm against std :: sort of the same values; small values make ties common.
+ template <class Type, std :: size_t Capacity> void compareWithStdSort(std :: size_t rounds)
+ {
+  typedef shMath :: fixedCapacityVector<Type, Capacity> vector;
+  for(std :: size_t round = 0u;round != rounds;++round)
+  {
+   const std :: size_t n = below(Capacity + 1u);
+   vector a;
+   for(std :: size_t i = 0u;i != n;++i) a.push_back(static_cast<Type>(static_cast<int>(below(11u)) - 5));
+   std :: vector<Type> expected(a.begin(), a.end());
+   std :: sort(expected.begin(), expected.end());
+   vector b(a);
+   shMath :: sort(b);
+   SH_MATH_CHECK(std :: equal(expected.begin(), expected.end(), b.begin()));
+   b = a;
+   shMath :: stable_sort(b);
+   SH_MATH_CHECK(std :: equal(expected.begin(), expected.end(), b.begin()));
+   b = a;
+   shMath :: sort(b, std :: greater<Type>());
+   SH_MATH_CHECK(std :: equal(expected.rbegin(), expected.rend(), b.begin()));
+   b = a;
+   shMath :: stable_sort(b, std :: greater<>());
+   SH_MATH_CHECK(std :: equal(expected.rbegin(), expected.rend(), b.begin()));
+   if (n != 0u)
+   {
+    const std :: size_t k = below(n);
+    b = a;
+    shMath :: nth_element(b, b.begin() + k);
+    SH_MATH_CHECK(b[k] == expected[k]);
+    for(std :: size_t i = 0u;i != k;++i) SH_MATH_CHECK(!(b[k] < b[i]));
+    for(std :: size_t i = k + 1u;i != n;++i) SH_MATH_CHECK(!(b[i] < b[k]));
+    b = a;
+    shMath :: partial_sort(b, b.begin() + k);
+    SH_MATH_CHECK(std :: equal(expected.begin(), expected.begin() + k, b.begin()));
+    SH_MATH_CHECK(std :: is_permutation(expected.begin(), expected.end(), b.begin()));
+    b = a;
+    shMath :: nth_element(b, b.begin() + k, std :: greater<Type>());
+    SH_MATH_CHECK(b[k] == expected[n - 1u - k]);
+   }
+  }
+ }
+
+ struct byFirstChar
+ {
+  bool operator () (const std :: string& a, const std :: string& b) const { return a[0] < b[0]; }
+ };
+
+ //Stability is only observable with a comparison that ties distinct elements.
+ void checkStability()
+ {
+  shMath :: fixedCapacityVector<std :: string, 8> a = {"b1", "a1", "b2", "a2", "c1", "a3"};
+  shMath :: stable_sort(a, byFirstChar());
+  const char* const expected[] = {"a1", "a2", "a3", "b1", "b2", "c1"};
+  SH_MATH_CHECK(std :: equal(a.begin(), a.end(), expected));
+ }
+
+ void checkSignedZeros()
+ {
+  shMath :: fixedCapacityVector<float, 8> a = {0.0f, -0.0f, 1.0f, -0.0f, 0.0f, std :: numeric_limits<float> :: infinity(), -1.0f};
+  shMath :: sort(a);
+  SH_MATH_CHECK((a[0] == -1.0f) && (a[5] == 1.0f) && (a[6] == std :: numeric_limits<float> :: infinity()));
+  SH_MATH_CHECK(std :: signbit(a[1]) + std :: signbit(a[2]) + std :: signbit(a[3]) + std :: signbit(a[4]) == 2);
+  shMath :: fixedCapacityVector<double, 16> b = {0.0, -0.0, 0.0, -0.0};
+  shMath :: stable_sort(b);
+  SH_MATH_CHECK(!std :: signbit(b[0]) && std :: signbit(b[1]) && !std :: signbit(b[2]) && std :: signbit(b[3]));
+ }
+}
+
+int main()
+{
+ compareWithStdSort<int, 1>(200u);
+ compareWithStdSort<int, 2>(500u);
+ compareWithStdSort<int, 3>(500u);
+ compareWithStdSort<int, 7>(2000u);
+ compareWithStdSort<int, 8>(2000u);
+ compareWithStdSort<int, 20>(2000u);
+ compareWithStdSort<int, 32>(2000u);
+ compareWithStdSort<int, 33>(2000u);
+ compareWithStdSort<int, 100>(500u);
+ compareWithStdSort<unsigned char, 17>(2000u);
+ compareWithStdSort<short, 31>(2000u);
+ compareWithStdSort<long long, 16>(2000u);
+ compareWithStdSort<float, 5>(2000u);
+ compareWithStdSort<double, 32>(2000u);
+ checkStability();
+ checkSignedZeros();
+ return 0;
+}
@@ -0,0 +1,203 @@
+#include "fixedcapacitystring.h"
+#include "shmathtest.h"
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#if (__cplusplus < 202002)
+#else
+#include <version>
+#ifdef __cpp_lib_format
+#include <format>
+#endif
+#endif
+
+namespace
+{
+ using shMathTest :: below;
+
+ template <std :: size_t Capacity> void checkSame(const shMath :: fixedCapacityString<Capacity>& a, const std :: string& b)
+ {
+  SH_MATH_CHECK((a.size() == b.size()) && (a.empty() == b.empty()) && (a.str() == b) && (a == b) && (b == a));
+  SH_MATH_CHECK(a.c_str()[a.size()] == '\0');
+ }
+
+ //A short random piece over a small alphabet, so finds hit often.
+ std :: string piece(std :: size_t most)
+ {
+  std :: string result(below(most + 1u), 'a');
+  for (char& c : result) c = static_cast<char>('a' + below(4u));
+  return result;
+ }
+
+ int sign(int n)
+ {
+  return (n > 0) - (n < 0);
+ }
+
+ //Random edits against std :: string; appends that would not fit must throw and leave the string alone, while try_append keeps what fits.
+ template <std :: size_t Capacity> void compareWithString(std :: size_t steps)
+ {
+  typedef shMath :: fixedCapacityString<Capacity> string;
+  string a;
+  std :: string b;
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const std :: string s = piece(Capacity / 4u);
+   const bool fits = (s.size() <= Capacity - b.size());
+   switch (below(9u))
+   {
+    case 0u:
+    if (fits)
+    {
+     a.append(s);
+     b.append(s);
+    }
+    else
+    {
+     SH_MATH_CHECK_THROWS(std :: bad_alloc, a.append(s));
+    }
+    break;
+    case 1u:
+    if (fits)
+    {
+     a += s.c_str();
+     b += s;
+    }
+    break;
+    case 2u:
+    {
+     //Self append, whole or from the middle.
+     const std :: size_t first = below(b.size() + 1u);
+     const std :: size_t n = below(b.size() - first + 1u);
+     if (n <= Capacity - b.size())
+     {
+      if (below(2u) == 0u)
+      {
+       a.append(a.data() + first, n);
+      }
+      else
+      {
+       SH_MATH_CHECK(a.try_append(a.data() + first, n));
+      }
+      b.append(b, first, n);
+     }
+     else
+     {
+      SH_MATH_CHECK_THROWS(std :: bad_alloc, a.append(a.data() + first, n));
+     }
+     if (b.size() <= Capacity - b.size())
+     {
+      a.append(a);
+      b.append(std :: string(b));
+     }
+    }
+    break;
+    case 3u:
+    {
+     const bool all = a.try_append(s.data(), s.size());
+     SH_MATH_CHECK(all == fits);
+     b.append(s, 0u, Capacity - b.size());
+     SH_MATH_CHECK(fits || (a.size() == Capacity));
+    }
+    break;
+    case 4u:
+    if (b.size() != Capacity)
+    {
+     const char c = static_cast<char>('a' + below(4u));
+     a.push_back(c);
+     b.push_back(c);
+    }
+    else
+    {
+     SH_MATH_CHECK_THROWS(std :: bad_alloc, a.push_back('x'));
+    }
+    break;
+    case 5u:
+    if (!b.empty())
+    {
+     a.pop_back();
+     b.pop_back();
+    }
+    break;
+    case 6u:
+    {
+     const std :: size_t n = below(Capacity + 1u);
+     a.resize(n, 'd');
+     b.resize(n, 'd');
+    }
+    break;
+    case 7u:
+    if (below(8u) == 0u)
+    {
+     a.clear();
+     b.clear();
+    }
+    break;
+    case 8u:
+    {
+     string c(a);
+     string d(s.c_str());
+     c.swap(d);
+     SH_MATH_CHECK((c == s) && (d == b));
+    }
+    break;
+   }
+   checkSame(a, b);
+   const std :: size_t pos = below(b.size() + 2u);
+   SH_MATH_CHECK(a.find(s.c_str(), pos) == b.find(s, pos));
+   SH_MATH_CHECK(a.find(s.c_str()) == b.find(s));
+   const char c = static_cast<char>('a' + below(5u));
+   SH_MATH_CHECK((a.find(c, pos) == b.find(c, pos)) && (a.contains(c) == (b.find(c) != std :: string :: npos)));
+   SH_MATH_CHECK(a.contains(s.c_str()) == (b.find(s) != std :: string :: npos));
+   SH_MATH_CHECK(a.starts_with(s.c_str()) == (b.compare(0u, s.size(), s) == 0));
+   SH_MATH_CHECK(a.ends_with(s.c_str()) == ((s.size() <= b.size()) && (b.compare(b.size() - s.size(), s.size(), s) == 0)));
+   const shMath :: fixedCapacityString<Capacity / 4u> e(s.c_str());
+   SH_MATH_CHECK((sign(a.compare(s.c_str())) == sign(b.compare(s))) && (sign(a.compare(e)) == sign(b.compare(s))));
+   SH_MATH_CHECK(((a < e) == (b < s)) && ((a == e) == (b == s)) && ((a >= e) == (b >= s)));
+   #if (__cplusplus < 201703)
+   #else
+   SH_MATH_CHECK((std :: hash<string>()(a) == std :: hash<std :: string>()(b)) && (a.hash() == std :: hash<std :: string>()(b)));
+   #endif
+  }
+ }
+
+ void checkAccess()
+ {
+  shMath :: fixedCapacityString<8> a("abc");
+  SH_MATH_CHECK((a.at(1u) == 'b') && (a.front() == 'a') && (a.back() == 'c'));
+  SH_MATH_CHECK_THROWS(std :: out_of_range, a.at(3u));
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, a = "too long for it");
+  SH_MATH_CHECK(a == "abc");
+  a = a.c_str() + 1;
+  SH_MATH_CHECK(a == "bc");
+  SH_MATH_CHECK(!a.try_append("0123456789", 10u) && (a == "bc012345") && (a.size() == a.capacity()));
+ }
+
+ void checkStreaming()
+ {
+  const shMath :: fixedCapacityString<16> a("streamed");
+  std :: ostringstream out;
+  out << '[' << a << ']' << shMath :: fixedCapacityString<4>();
+  SH_MATH_CHECK(out.str() == "[streamed]");
+  #if (__cplusplus < 202002)
+  #else
+  #ifdef __cpp_lib_format
+  SH_MATH_CHECK(std :: format("{}|{:>10}|{:.3}", a, a, a) == "streamed|  streamed|str");
+  #endif
+  #endif
+ }
+}
+
+int main()
+{
+ compareWithString<16>(50000u);
+ compareWithString<64>(50000u);
+ compareWithString<255>(20000u);
+ checkAccess();
+ checkStreaming();
+ return 0;
+}
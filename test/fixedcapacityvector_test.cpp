@@ -0,0 +1,536 @@
+#include "fixedcapacityvector.h"
+#include "fixedcapacitysort.h"
+#include "shmathtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+static_assert(sizeof(shMath :: fixedCapacityVector<char, 15>) == 16u, "Counter of fixedCapacityVector<char, 15> should fit into a single byte.");
+static_assert(sizeof(shMath :: fixedCapacityVector<std :: uint16_t, 3>) == 8u, "Counter of fixedCapacityVector<uint16_t, 3> should not add alignment padding.");
+static_assert(sizeof(shMath :: fixedCapacityVector<std :: uint32_t, 3>) == 16u, "Counter of fixedCapacityVector<uint32_t, 3> should not exceed alignment of uint32_t.");
+static_assert(sizeof(shMath :: fixedCapacityVector<std :: uint8_t, 255>) == 256u, "Counter of fixedCapacityVector<uint8_t, 255> should fit into a single byte.");
+static_assert(sizeof(shMath :: fixedCapacityVector<std :: uint8_t, 256>) == 258u, "Counter of fixedCapacityVector<uint8_t, 256> should fit into two bytes.");
+static_assert(alignof(shMath :: alignedFixedCapacityVector<char, 3>) == SH_MATH_CACHE_LINE_SIZE, "alignedFixedCapacityVector should start on a cache line by default.");
+static_assert(sizeof(shMath :: alignedFixedCapacityVector<char, 3>) == SH_MATH_CACHE_LINE_SIZE, "alignedFixedCapacityVector should be padded to a whole cache line.");
+static_assert(sizeof(shMath :: fixedCapacityVectorWireHeader) == 24u, "fixedCapacityVectorWireHeader should have no padding.");
+static_assert(shMath :: fixedCapacityVectorWireOffset<double>() == 24u, "Elements aligned to 8 bytes should directly follow the wire header.");
+static_assert(std :: is_trivially_copyable<shMath :: alignedFixedCapacityVector<int, 4, 32> > :: value, "alignedFixedCapacityVector of trivially copyable elements should stay trivially copyable.");
+static_assert(sizeof(shMath :: fixedCapacityVector<bool, 64>) == 16u, "fixedCapacityVector<bool, 64> should pack its flags into a single word.");
+static_assert(sizeof(shMath :: fixedCapacityVector<bool, 256>) == 40u, "fixedCapacityVector<bool, 256> should pack its flags into four words.");
+static_assert(std :: is_trivially_copyable<shMath :: fixedCapacityVector<bool, 100> > :: value, "Packed fixedCapacityVector<bool, Capacity> should be trivially copyable.");
+
+namespace
+{
+ using shMathTest :: below;
+ using shMathTest :: value;
+
+ template <class Vector, class Reference> void checkSame(const Vector& a, const Reference& b)
+ {
+  SH_MATH_CHECK(a.size() == b.size());
+  SH_MATH_CHECK(a.empty() == b.empty());
+  SH_MATH_CHECK(std :: equal(b.begin(), b.end(), a.begin()));
+ }
+
+ template <class Type> std :: vector<Type> values(std :: size_t n)
+ {
+  std :: vector<Type> result;
+  for(std :: size_t i = 0u;i != n;++i) result.push_back(value<Type>());
+  return result;
+ }
+
+ //Runs the same random bulk operations on two fixedCapacityVector objects and two std :: vector objects, staying within Capacity.
+ template <class Type, std :: size_t Capacity> void compareWithVector(std :: size_t steps)
+ {
+  typedef shMath :: fixedCapacityVector<Type, Capacity> vector;
+  vector a[2];
+  std :: vector<Type> b[2];
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const std :: size_t i = below(2u);
+   vector& v = a[i];
+   std :: vector<Type>& r = b[i];
+   const std :: size_t room = Capacity - r.size();
+   const std :: size_t pos = below(r.size() + 1u);
+   const Type val = value<Type>();
+   switch (below(18u))
+   {
+    case 0u:
+    if (room != 0u)
+    {
+     v.push_back(val);
+     r.push_back(val);
+    }
+    break;
+    case 1u:
+    if (!r.empty())
+    {
+     v.pop_back();
+     r.pop_back();
+    }
+    break;
+    case 2u:
+    if (room != 0u)
+    {
+     SH_MATH_CHECK(*v.insert(v.begin() + pos, val) == val);
+     r.insert(r.begin() + pos, val);
+    }
+    break;
+    case 3u:
+    {
+     const std :: size_t n = below(room + 1u);
+     SH_MATH_CHECK(v.insert(v.begin() + pos, n, val) == v.begin() + pos);
+     r.insert(r.begin() + pos, n, val);
+    }
+    break;
+    case 4u:
+    {
+     const std :: vector<Type> in = values<Type>(below(room + 1u));
+     v.insert(v.begin() + pos, in.begin(), in.end());
+     r.insert(r.begin() + pos, in.begin(), in.end());
+    }
+    break;
+    case 5u:
+    {
+     const std :: vector<Type> in = values<Type>(below(room + 1u));
+     const std :: list<Type> list(in.begin(), in.end());
+     v.insert(v.begin() + pos, list.begin(), list.end());
+     r.insert(r.begin() + pos, list.begin(), list.end());
+    }
+    break;
+    case 6u:
+    if (pos != r.size())
+    {
+     v.erase(v.begin() + pos);
+     r.erase(r.begin() + pos);
+    }
+    break;
+    case 7u:
+    {
+     const std :: size_t last = pos + below(r.size() - pos + 1u);
+     SH_MATH_CHECK(v.erase(v.begin() + pos, v.begin() + last) == v.begin() + pos);
+     r.erase(r.begin() + pos, r.begin() + last);
+    }
+    break;
+    case 8u:
+    {
+     const std :: size_t n = below(Capacity + 1u);
+     v.resize(n);
+     r.resize(n);
+    }
+    break;
+    case 9u:
+    {
+     const std :: size_t n = below(Capacity + 1u);
+     v.resize(n, val);
+     r.resize(n, val);
+    }
+    break;
+    case 10u:
+    {
+     const std :: size_t n = below(Capacity + 1u);
+     v.assign(n, val);
+     r.assign(n, val);
+    }
+    break;
+    case 11u:
+    {
+     const std :: vector<Type> in = values<Type>(below(Capacity + 1u));
+     v.assign(in.begin(), in.end());
+     r.assign(in.begin(), in.end());
+    }
+    break;
+    case 12u:
+    v.swap(a[1u - i]);
+    r.swap(b[1u - i]);
+    break;
+    case 13u:
+    a[1u - i] = v;
+    b[1u - i] = r;
+    break;
+    case 14u:
+    a[1u - i] = std :: move(v);
+    b[1u - i] = std :: move(r);
+    v.clear();
+    r.clear();
+    break;
+    case 15u:
+    {
+     const std :: size_t n = below(room + 1u);
+     const std :: size_t k = below(n + 1u);
+     SH_MATH_CHECK(v.write_into(n, [&val, k](Type* out, std :: size_t) { for(std :: size_t j = 0u;j != k;++j) new (out + j) Type(val); return k; }) == k);
+     r.insert(r.end(), k, val);
+    }
+    break;
+    case 16u:
+    if (room != 0u)
+    {
+     SH_MATH_CHECK(*v.emplace(v.begin() + pos, val) == val);
+     r.emplace(r.begin() + pos, val);
+    }
+    break;
+    case 17u:
+    {
+     const vector copy(v);
+     checkSame(copy, r);
+     const vector moved(std :: move(v));
+     v = moved;
+    }
+    break;
+   }
+   checkSame(v, r);
+   if (!r.empty())
+   {
+    SH_MATH_CHECK((v.front() == r.front()) && (v.back() == r.back()) && (v.at(r.size() - 1u) == r.back()));
+    SH_MATH_CHECK(v.contains(r[pos % r.size()]) && (v.count(r[pos % r.size()]) == static_cast<std :: size_t>(std :: count(r.begin(), r.end(), r[pos % r.size()]))));
+   }
+   SH_MATH_CHECK(((a[0] == a[1]) == (b[0] == b[1])) && ((a[0] < a[1]) == (b[0] < b[1])));
+  }
+ }
+
+ //A full vector refuses more elements without touching the ones it holds.
+ template <class Type> void checkOverflow()
+ {
+  shMath :: fixedCapacityVector<Type, 4> v;
+  const std :: vector<Type> in = values<Type>(4u);
+  v.assign(in.begin(), in.end());
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, v.push_back(in[0]));
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, v.insert(v.begin(), in[1]));
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, v.resize(5u));
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, v.write_into(1u, [](Type*, std :: size_t) { return std :: size_t(0u); }));
+  SH_MATH_CHECK_THROWS(std :: out_of_range, v.at(4u));
+  SH_MATH_CHECK(v.try_push_back(in[0]) == nullptr);
+  checkSame(v, in);
+  v.pop_back();
+  SH_MATH_CHECK_THROWS(std :: out_of_range, v.write_into(1u, [](Type*, std :: size_t) { return std :: size_t(2u); }));
+  SH_MATH_CHECK(v.size() == 3u);
+ }
+
+ //The packed specialization against std :: vector<bool>, including the invariant that bits past size() stay clear.
+ void compareBools(std :: size_t steps)
+ {
+  typedef shMath :: fixedCapacityVector<bool, 200> vector;
+  vector v;
+  std :: vector<bool> r;
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const std :: size_t pos = below(r.size() + 1u);
+   const bool val = (below(2u) == 0u);
+   switch (below(10u))
+   {
+    case 0u:
+    if (r.size() != 200u)
+    {
+     v.push_back(val);
+     r.push_back(val);
+    }
+    break;
+    case 1u:
+    if (!r.empty())
+    {
+     v.pop_back();
+     r.pop_back();
+    }
+    break;
+    case 2u:
+    {
+     const std :: size_t n = below(201u - r.size());
+     v.insert(v.cbegin() + pos, n, val);
+     r.insert(r.begin() + pos, n, val);
+    }
+    break;
+    case 3u:
+    {
+     const std :: size_t last = pos + below(r.size() - pos + 1u);
+     v.erase(v.cbegin() + pos, v.cbegin() + last);
+     r.erase(r.begin() + pos, r.begin() + last);
+    }
+    break;
+    case 4u:
+    {
+     const std :: size_t n = below(201u);
+     v.resize(n, val);
+     r.resize(n, val);
+    }
+    break;
+    case 5u:
+    v.flip();
+    r.flip();
+    break;
+    case 6u:
+    if (pos != r.size())
+    {
+     v[pos] = !v[pos];
+     r[pos] = !r[pos];
+    }
+    break;
+    case 7u:
+    {
+     vector w(v.size(), false);
+     std :: vector<bool> s(r.size(), false);
+     for(std :: size_t j = 0u;j != s.size();++j)
+     {
+      w[j] = s[j] = (below(2u) == 0u);
+     }
+     switch (below(3u))
+     {
+      case 0u:
+      v &= w;
+      for(std :: size_t j = 0u;j != s.size();++j) r[j] = r[j] && s[j];
+      break;
+      case 1u:
+      v |= w;
+      for(std :: size_t j = 0u;j != s.size();++j) r[j] = r[j] || s[j];
+      break;
+      default:
+      v = v ^ w;
+      for(std :: size_t j = 0u;j != s.size();++j) r[j] = (r[j] != s[j]);
+      break;
+     }
+     SH_MATH_CHECK(((v == w) == (r == s)) && ((v < w) == (r < s)));
+    }
+    break;
+    case 8u:
+    {
+     vector sorted(v);
+     std :: vector<bool> expected(r);
+     std :: sort(expected.begin(), expected.end());
+     shMath :: sort(sorted);
+     checkSame(sorted, expected);
+     sorted = v;
+     shMath :: stable_sort(sorted, std :: greater<bool>());
+     SH_MATH_CHECK(std :: equal(expected.rbegin(), expected.rend(), sorted.begin()));
+     sorted = v;
+     shMath :: nth_element(sorted, sorted.begin() + pos / 2u);
+     checkSame(sorted, expected);
+     sorted = v;
+     shMath :: partial_sort(sorted, sorted.begin() + pos / 2u);
+     checkSame(sorted, expected);
+    }
+    break;
+    case 9u:
+    {
+     const shMath :: fixedCapacityVector<bool, 256> wider(v);
+     SH_MATH_CHECK(wider == v);
+     v = wider;
+    }
+    break;
+   }
+   checkSame(v, r);
+   const std :: size_t used = (r.size() + 63u) / 64u;
+   if ((r.size() % 64u) != 0u)
+   {
+    SH_MATH_CHECK((v.words()[used - 1u] >> (r.size() % 64u)) == 0u);
+   }
+   for(std :: size_t j = used;j != vector :: word_count;++j) SH_MATH_CHECK(v.words()[j] == 0u);
+   SH_MATH_CHECK(v.count() == static_cast<std :: size_t>(std :: count(r.begin(), r.end(), true)));
+   const std :: size_t first = static_cast<std :: size_t>(std :: find(r.begin(), r.end(), true) - r.begin());
+   SH_MATH_CHECK(v.find_first() == ((first == r.size()) ? vector :: npos : first));
+   SH_MATH_CHECK(v.find(false) - v.begin() == std :: find(r.begin(), r.end(), false) - r.begin());
+   std :: size_t ones = 0u;
+   for(std :: size_t j = v.find_first();j != vector :: npos;j = v.find_next(j))
+   {
+    SH_MATH_CHECK(r[j]);
+    ++ones;
+   }
+   SH_MATH_CHECK(ones == v.count());
+  }
+ }
+
+ //resize_default_init and spare_capacity with commit against std :: vector; new ints are written before they are read, other types start value initialized.
+ template <class Type> void compareUninitializedGrowth(std :: size_t steps)
+ {
+  typedef shMath :: fixedCapacityVector<Type, 32> vector;
+  vector a;
+  std :: vector<Type> b;
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const std :: size_t n = below(33u);
+   switch (below(3u))
+   {
+    case 0u:
+    {
+     const std :: size_t old = b.size();
+     a.resize_default_init(n);
+     b.resize(n);
+     for(std :: size_t i = old;i < n;++i)
+     {
+      if (std :: is_trivially_default_constructible<Type> :: value)
+      {
+       a[i] = b[i] = value<Type>();
+      }
+      else
+      {
+       SH_MATH_CHECK(a[i] == Type());
+      }
+     }
+    }
+    break;
+    case 1u:
+    {
+     const std :: size_t k = below(33u - b.size());
+     Type* const spare = a.spare_capacity();
+     SH_MATH_CHECK(spare == a.data() + a.size());
+     for(std :: size_t i = 0u;i != k;++i)
+     {
+      b.push_back(value<Type>());
+      ::new (static_cast<void*>(spare + i)) Type(b.back());
+     }
+     a.commit(k);
+    }
+    break;
+    case 2u:
+    {
+     const std :: size_t before = b.size();
+     SH_MATH_CHECK_THROWS(std :: bad_alloc, a.resize_default_init(33u + n));
+     SH_MATH_CHECK_THROWS(std :: bad_alloc, a.commit(33u - before + n));
+     SH_MATH_CHECK(a.size() == before);
+    }
+    break;
+   }
+   checkSame(a, b);
+  }
+ }
+
+ #if (__cplusplus < 202002)
+ #else
+ //append_range from forward ranges, moved elements and the vector itself.
+ template <class Type> void checkAppendRange()
+ {
+  typedef shMath :: fixedCapacityVector<Type, 12> vector;
+  const std :: vector<Type> in = values<Type>(12u);
+  const std :: list<Type> source(in.begin(), in.begin() + 5);
+  vector a;
+  a.append_range(source);
+  std :: vector<Type> b(in.begin(), in.begin() + 5);
+  checkSame(a, b);
+  //Appending the vector to itself reads only the elements it had before.
+  a.append_range(a);
+  b.insert(b.end(), in.begin(), in.begin() + 5);
+  checkSame(a, b);
+  //A range that does not fit is refused before anything is appended, since its size is known.
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, a.append_range(source));
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, a.append_range(a));
+  checkSame(a, b);
+  std :: vector<Type> moved(in.begin() + 10, in.end());
+  a.append_range(std :: ranges :: subrange(std :: make_move_iterator(moved.begin()), std :: make_move_iterator(moved.end())));
+  b.insert(b.end(), in.begin() + 10, in.end());
+  checkSame(a, b);
+ }
+
+ //Single pass sources: a sized one is still refused up front, while an unsized one only finds out it overflows once the vector is full.
+ void checkAppendInputRange()
+ {
+  typedef std :: istream_iterator<int> input;
+  std :: istringstream text("1 2 3 4 5 6");
+  shMath :: fixedCapacityVector<int, 8> a{9, 8};
+  a.append_range(std :: ranges :: subrange(input(text), input()));
+  checkSame(a, std :: vector<int>{9, 8, 1, 2, 3, 4, 5, 6});
+  a.resize(5u);
+  std :: istringstream sized("10 11 12 13");
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, a.append_range(std :: views :: counted(input(sized), 4)));
+  checkSame(a, std :: vector<int>{9, 8, 1, 2, 3});
+  a.append_range(std :: views :: counted(input(sized), 2));
+  a.pop_back();
+  a.pop_back();
+  std :: istringstream unsized("20 21 22 23");
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, a.append_range(std :: ranges :: subrange(input(unsized), input())));
+  checkSame(a, std :: vector<int>{9, 8, 1, 2, 3, 20, 21, 22});
+ }
+ #endif
+
+ //Round trips through the wire format, into vectors and read only views, and every way a buffer can be refused.
+ template <class Type, class Other> void checkSerialization(std :: size_t rounds)
+ {
+  typedef shMath :: fixedCapacityVector<Type, 32> vector;
+  for(std :: size_t round = 0u;round != rounds;++round)
+  {
+   vector a;
+   const std :: size_t n = below(33u);
+   for(std :: size_t i = 0u;i != n;++i) a.push_back(static_cast<Type>(below(1000u)) / static_cast<Type>(4));
+   const std :: size_t bytes = a.serialized_size();
+   SH_MATH_CHECK(bytes == shMath :: fixedCapacityVectorWireOffset<Type>() + n * sizeof(Type));
+   std :: vector<std :: uint64_t> words(bytes / 8u + 2u); //Aligned for any element, with room for a shifted copy.
+   unsigned char* const buffer = reinterpret_cast<unsigned char*>(words.data());
+   SH_MATH_CHECK((a.serialize_to(buffer, bytes - 1u) == 0u) && (a.serialize_to(nullptr, bytes) == 0u));
+   SH_MATH_CHECK(a.serialize_to(buffer, bytes) == bytes);
+   vector b(3u, Type(1));
+   SH_MATH_CHECK(b.deserialize_from(buffer, bytes) && (b == a));
+   shMath :: fixedCapacityVector<Type, 40> wider;
+   SH_MATH_CHECK(wider.deserialize_from(buffer, bytes + 5u) && std :: equal(a.begin(), a.end(), wider.begin(), wider.end()));
+   shMath :: fixedCapacityVectorView<Type, 32> view;
+   SH_MATH_CHECK(view.attach(buffer, bytes) && (view.capacity() == 32u) && (view.size() == n));
+   SH_MATH_CHECK(std :: equal(a.begin(), a.end(), view.begin(), view.end()) && (view.empty() == a.empty()));
+   SH_MATH_CHECK((static_cast<const void*>(view.data()) == buffer + shMath :: fixedCapacityVectorWireOffset<Type>()));
+   SH_MATH_CHECK_THROWS(std :: out_of_range, view.at(n));
+   if (n != 0u)
+   {
+    SH_MATH_CHECK((view.front() == a.front()) && (view.back() == a.back()) && view.contains(a[n / 2u]) && (view.at(n - 1u) == a.back()));
+    //Too short, too small a capacity or too short for its elements: the target keeps what it had and the view empties.
+    shMath :: fixedCapacityVector<Type, 32> c(2u, Type(3));
+    SH_MATH_CHECK(!c.deserialize_from(buffer, bytes - 1u) && (c.size() == 2u) && (c[1] == Type(3)));
+    SH_MATH_CHECK(!view.attach(buffer, bytes - sizeof(Type)) && view.empty() && (view.data() == nullptr));
+    if (n > 1u)
+    {
+     shMath :: fixedCapacityVector<Type, 1> narrow;
+     SH_MATH_CHECK(!narrow.deserialize_from(buffer, bytes) && narrow.empty());
+     shMath :: fixedCapacityVectorView<Type, 1> narrowView;
+     SH_MATH_CHECK(!narrowView.attach(buffer, bytes));
+    }
+   }
+   for(std :: size_t cut = 0u;cut < sizeof(shMath :: fixedCapacityVectorWireHeader);cut += 3u) SH_MATH_CHECK(!b.deserialize_from(buffer, cut) && (b == a));
+   //Another element type, a moved copy that misaligns the elements, and damaged header fields.
+   shMath :: fixedCapacityVector<Other, 32> other;
+   SH_MATH_CHECK(!other.deserialize_from(buffer, bytes) && other.empty());
+   std :: memmove(buffer + 1, buffer, bytes);
+   SH_MATH_CHECK(b.deserialize_from(buffer + 1, bytes) && (b == a));
+   SH_MATH_CHECK((alignof(Type) == 1u) || !view.attach(buffer + 1, bytes));
+   std :: memmove(buffer, buffer + 1, bytes);
+   for(std :: size_t field = 0u;field != 12u;++field)
+   {
+    buffer[field] ^= 0x40u;
+    SH_MATH_CHECK(!b.deserialize_from(buffer, bytes) && !view.attach(buffer, bytes));
+    buffer[field] ^= 0x40u;
+   }
+   SH_MATH_CHECK(view.attach(buffer, bytes) && b.deserialize_from(buffer, bytes) && (b == a));
+   #if (__cplusplus < 202002)
+   #else
+   const std :: span<std :: byte> span(reinterpret_cast<std :: byte*>(buffer), bytes);
+   SH_MATH_CHECK((a.serialize_to(span) == bytes) && (a.serialize_to(span.first(bytes - 1u)) == 0u));
+   SH_MATH_CHECK(b.deserialize_from(std :: span<const std :: byte>(span)) && (b == a) && view.attach(std :: span<const std :: byte>(span)));
+   #endif
+  }
+ }
+}
+
+int main()
+{
+ compareWithVector<int, 24>(20000u);
+ compareWithVector<std :: string, 24>(20000u);
+ compareWithVector<int, 300>(5000u);
+ checkOverflow<int>();
+ checkOverflow<std :: string>();
+ compareBools(50000u);
+#if (__cplusplus < 202002)
+#else
+ checkAppendRange<int>();
+ checkAppendRange<std :: string>();
+ checkAppendInputRange();
+#endif
+ compareUninitializedGrowth<int>(20000u);
+ compareUninitializedGrowth<std :: string>(20000u);
+ checkSerialization<int, double>(2000u);
+ checkSerialization<double, std :: int32_t>(2000u);
+ checkSerialization<std :: uint16_t, std :: int64_t>(2000u);
+ return 0;
+}
@@ -0,0 +1,59 @@
+//Checked entirely at compile time: the C++20 constexpr members and the range and span concepts.
+#include "fixedcapacityvector.h"
+
+#include <type_traits>
+#if (__cplusplus < 202002)
+#else
+#include <ranges>
+#include <span>
+#endif
+
+#if (__cplusplus < 202002)
+#else
+static_assert([]() constexpr
+{
+ shMath :: fixedCapacityVector<int, 4> a{1, 2};
+ a.push_back(3);
+ a.emplace_back(4);
+ a.pop_back();
+ const shMath :: fixedCapacityVector<int, 8> b(a);
+ return b.at(2) + b[0] + static_cast<int>(b.size());
+}() == 7, "fixedCapacityVector should be usable in constant expressions.");
+static_assert([]() constexpr
+{
+ shMath :: fixedCapacityVector<int, 8> a{1, 2, 5};
+ const int extra[] = {3, 4};
+ a.insert(a.begin() + 2, extra, extra + 2);
+ a.erase(a.begin());
+ a.resize(6, 7);
+ shMath :: fixedCapacityVector<int, 8> b;
+ b.assign(2u, 9);
+ swap(a, b);
+ return b[0] * 100 + b[4] * 10 + static_cast<int>(a.size() + b.size());
+}() == 278, "Sequence modifiers of fixedCapacityVector should be usable in constant expressions.");
+static_assert([]() constexpr
+{
+ const shMath :: fixedCapacityVector<int, 4> a{1, 2, 3};
+ const shMath :: fixedCapacityVector<int, 8> b{1, 2, 4};
+ return (a < b) && (a != b) && a.contains(3) && (a.count(2) == 1u) && (a.find(4) == a.end());
+}(), "Comparison and search of fixedCapacityVector should be usable in constant expressions.");
+static_assert([]() constexpr
+{
+ shMath :: fixedCapacityVector<bool, 130> a(70u, true);
+ a.insert(a.begin() + 3, 2u, false);
+ a[10] = false;
+ a.push_back(true);
+ shMath :: fixedCapacityVector<bool, 130> b(a.size(), false);
+ b.set(4u);
+ return (a.count() == 70u) && (a.find_first() == 0u) && (a.find_next(2u) == 5u) && (a.find(false) == a.begin() + 3) && ((a & b).count() == 0u) && ((a | b).count() == 71u) && (b < a);
+}(), "Packed fixedCapacityVector<bool, Capacity> should be usable in constant expressions.");
+static_assert(std :: ranges :: contiguous_range<shMath :: fixedCapacityVector<int, 4> >, "fixedCapacityVector should model contiguous_range.");
+static_assert(std :: ranges :: sized_range<shMath :: fixedCapacityVector<int, 4> >, "fixedCapacityVector should model sized_range.");
+static_assert(std :: is_convertible<shMath :: fixedCapacityVector<int, 4>&, std :: span<int> > :: value, "fixedCapacityVector should convert to std::span.");
+static_assert(std :: is_convertible<const shMath :: fixedCapacityVector<int, 4>&, std :: span<const int> > :: value, "fixedCapacityVector should convert to std::span of const elements.");
+#endif
+
+int main()
+{
+ return 0;
+}
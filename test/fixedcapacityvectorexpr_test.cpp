@@ -0,0 +1,154 @@
+#include "fixedcapacityvectorexpr.h"
+#include "shmathtest.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+ template <class ... Types> struct always
+ {
+  typedef void type;
+ };
+
+ template <class Left, class Right, class = void> struct multiplies : std :: false_type
+ {
+ };
+
+ template <class Left, class Right> struct multiplies<Left, Right, typename always<decltype(std :: declval<const Left&>() * std :: declval<const Right&>())> :: type> : std :: true_type
+ {
+ };
+
+ template <class Left, class Right, class = void> struct dividesInPlace : std :: false_type
+ {
+ };
+
+ template <class Left, class Right> struct dividesInPlace<Left, Right, typename always<decltype(std :: declval<Left&>() /= std :: declval<const Right&>())> :: type> : std :: true_type
+ {
+ };
+
+ typedef shMath :: fixedCapacityVector<int, 8> ints;
+ typedef shMath :: fixedCapacityVector<float, 8> floats;
+ typedef shMath :: fixedCapacityVector<double, 8> doubles;
+}
+
+static_assert(multiplies<ints, int> :: value && multiplies<int, ints> :: value && multiplies<doubles, double> :: value && multiplies<ints, ints> :: value, "Vectors should combine with vectors and scalars of their element type.");
+static_assert(multiplies<doubles, int> :: value && multiplies<floats, long> :: value && dividesInPlace<doubles, int> :: value, "Integer scalars should scale floating point vectors.");
+static_assert(!multiplies<ints, double> :: value && !multiplies<double, ints> :: value && !dividesInPlace<ints, double> :: value, "A floating point scalar should not truncate into an int vector.");
+static_assert(!multiplies<ints, long long> :: value && !multiplies<floats, double> :: value && !dividesInPlace<floats, double> :: value, "A scalar wider than the element type should be rejected.");
+static_assert(!multiplies<ints, doubles> :: value && !multiplies<shMath :: fixedCapacityVector<bool, 8>, bool> :: value, "Vectors of different element types and packed bool vectors should not combine.");
+
+namespace
+{
+ using shMathTest :: below;
+
+ //Exact for integers; floating point may round differently, since dot sums in another order and a * b + c may contract into a fused multiply-add.
+ template <class Type> bool close(Type a, Type b)
+ {
+  const double slack = 256.0 * static_cast<double>(std :: numeric_limits<Type> :: epsilon()) * (1000.0 + std :: fabs(static_cast<double>(b)));
+  return std :: fabs(static_cast<double>(a) - static_cast<double>(b)) <= slack;
+ }
+
+ template <class Type, std :: size_t Capacity> void fill(shMath :: fixedCapacityVector<Type, Capacity>& a, std :: vector<Type>& b, std :: size_t n)
+ {
+  a.clear();
+  b.clear();
+  for(std :: size_t i = 0u;i != n;++i)
+  {
+   const Type val = static_cast<Type>(static_cast<int>(below(2001u)) - 1000) / static_cast<Type>(std :: is_integral<Type> :: value ? 1 : 64);
+   a.push_back(val);
+   b.push_back(val);
+  }
+ }
+
+ template <class Type, std :: size_t Capacity> void checkSame(const shMath :: fixedCapacityVector<Type, Capacity>& a, const std :: vector<Type>& b)
+ {
+  SH_MATH_CHECK(a.size() == b.size());
+  for(std :: size_t i = 0u;i != b.size();++i) SH_MATH_CHECK(close(a[i], b[i]));
+ }
+
+ //Every expression against the same loop written out over std :: vector.
+ template <class Type, std :: size_t Capacity> void compareWithLoops(std :: size_t rounds)
+ {
+  typedef shMath :: fixedCapacityVector<Type, Capacity> vector;
+  vector a, b, c;
+  std :: vector<Type> x, y, z, expected;
+  for(std :: size_t round = 0u;round != rounds;++round)
+  {
+   const std :: size_t n = below(Capacity + 1u);
+   fill(a, x, n);
+   fill(b, y, n);
+   fill(c, z, n);
+   const Type k = static_cast<Type>(below(7u) + 1u);
+
+   vector result = a * b + c;
+   expected.clear();
+   for(std :: size_t i = 0u;i != n;++i) expected.push_back(x[i] * y[i] + z[i]);
+   checkSame(result, expected);
+
+   shMath :: assign(result, shMath :: fma(a, b, c) - k * a);
+   for(std :: size_t i = 0u;i != n;++i) expected[i] = x[i] * y[i] + z[i] - k * x[i];
+   checkSame(result, expected);
+
+   shMath :: assign(result, -(a + b) / k);
+   for(std :: size_t i = 0u;i != n;++i) expected[i] = -(x[i] + y[i]) / k;
+   checkSame(result, expected);
+
+   //The target may appear on the right.
+   shMath :: assign(result, result * 2 - c);
+   for(std :: size_t i = 0u;i != n;++i) expected[i] = expected[i] * 2 - z[i];
+   checkSame(result, expected);
+
+   result += a * b;
+   for(std :: size_t i = 0u;i != n;++i) expected[i] += x[i] * y[i];
+   checkSame(result, expected);
+   result -= 3;
+   for(std :: size_t i = 0u;i != n;++i) expected[i] -= 3;
+   checkSame(result, expected);
+   result *= c;
+   for(std :: size_t i = 0u;i != n;++i) expected[i] *= z[i];
+   checkSame(result, expected);
+   result /= k;
+   for(std :: size_t i = 0u;i != n;++i) expected[i] /= k;
+   checkSame(result, expected);
+
+   Type sum = Type(), squares = Type();
+   for(std :: size_t i = 0u;i != n;++i)
+   {
+    sum += x[i] * (y[i] + z[i]);
+    squares += x[i] * x[i];
+   }
+   SH_MATH_CHECK(close(shMath :: dot(a, b + c), sum));
+   typedef decltype(shMath :: norm(a)) root;
+   SH_MATH_CHECK(close(shMath :: norm(a), static_cast<root>(std :: sqrt(static_cast<double>(squares)))));
+
+   //Sizes differ: building the node or updating in place throws before anything is written.
+   if (n != 0u)
+   {
+    vector shorter(a);
+    shorter.pop_back();
+    const vector before(result);
+    SH_MATH_CHECK_THROWS(std :: out_of_range, result = a + shorter);
+    SH_MATH_CHECK_THROWS(std :: out_of_range, shMath :: fma(a, b, shorter));
+    SH_MATH_CHECK_THROWS(std :: out_of_range, shMath :: dot(shorter, b));
+    SH_MATH_CHECK_THROWS(std :: out_of_range, result += shorter);
+    SH_MATH_CHECK_THROWS(std :: out_of_range, result /= shorter * 2);
+    SH_MATH_CHECK(result == before);
+   }
+  }
+ }
+}
+
+int main()
+{
+ compareWithLoops<double, 16>(20000u);
+ compareWithLoops<float, 37>(20000u);
+ compareWithLoops<int, 24>(20000u);
+ compareWithLoops<long long, 5>(20000u);
+ return 0;
+}
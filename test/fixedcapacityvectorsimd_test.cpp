@@ -0,0 +1,119 @@
+//Built three times: for the default target, with -mavx2 and with SH_MATH_NO_SIMD, so each search path runs against the standard algorithms.
+#include "fixedcapacityvector.h"
+#include "fixedcapacitystring.h"
+#include "shmathtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(SH_MATH_NO_SIMD) && (defined(SH_MATH_SIMD_AVX2) || defined(SH_MATH_SIMD_SSE2))
+#error SH_MATH_NO_SIMD should keep the searches scalar.
+#endif
+#if defined(__AVX2__) && !defined(SH_MATH_NO_SIMD) && !defined(SH_MATH_SIMD_AVX2)
+#error AVX2 targets should use the AVX2 search.
+#endif
+
+namespace
+{
+ using shMathTest :: below;
+
+ //Few distinct values, the extremes among them, so matches are frequent and every lane pattern shows up.
+ template <class Type> std :: vector<Type> alphabet()
+ {
+  return std :: vector<Type>{Type(0), Type(1), Type(2), std :: numeric_limits<Type> :: min(), std :: numeric_limits<Type> :: max(), static_cast<Type>(std :: numeric_limits<Type> :: max() - 1)};
+ }
+
+ //Signed zeros compare equal and NaN equals nothing, not even itself, so no bitwise shortcut may apply.
+ template <class Type> std :: vector<Type> floatingAlphabet()
+ {
+  return std :: vector<Type>{Type(0), -Type(0), std :: numeric_limits<Type> :: quiet_NaN(), Type(1.5), -std :: numeric_limits<Type> :: infinity(), std :: numeric_limits<Type> :: denorm_min()};
+ }
+
+ template <> std :: vector<float> alphabet<float>()
+ {
+  return floatingAlphabet<float>();
+ }
+
+ template <> std :: vector<double> alphabet<double>()
+ {
+  return floatingAlphabet<double>();
+ }
+
+ //find, count, contains and == over every length up to Capacity and every start within a register, against std :: find, std :: count and std :: equal.
+ template <class Type> void compareSearches(std :: size_t rounds)
+ {
+  const std :: size_t capacity = 100u;
+  typedef shMath :: fixedCapacityVector<Type, capacity> vector;
+  const std :: vector<Type> values = alphabet<Type>();
+  for(std :: size_t round = 0u;round != rounds;++round)
+  {
+   vector a;
+   std :: vector<Type> b;
+   const std :: size_t n = below(capacity + 1u);
+   const std :: size_t spread = 1u + below(values.size());
+   for(std :: size_t i = 0u;i != n;++i)
+   {
+    b.push_back(values[below(spread)]);
+    a.push_back(b.back());
+   }
+   for (const Type& val : values)
+   {
+    SH_MATH_CHECK(a.find(val) - a.begin() == std :: find(b.begin(), b.end(), val) - b.begin());
+    SH_MATH_CHECK(a.count(val) == static_cast<std :: size_t>(std :: count(b.begin(), b.end(), val)));
+    SH_MATH_CHECK(a.contains(val) == (std :: find(b.begin(), b.end(), val) != b.end()));
+    const std :: size_t first = below(n + 1u);
+    const std :: size_t last = first + below(n - first + 1u);
+    SH_MATH_CHECK(shMath :: fixedCapacityVectorFind(a.data() + first, a.data() + last, val) - a.data() == std :: find(b.begin() + first, b.begin() + last, val) - b.begin());
+    SH_MATH_CHECK(shMath :: fixedCapacityVectorCount(a.data() + first, a.data() + last, val) == static_cast<std :: size_t>(std :: count(b.begin() + first, b.begin() + last, val)));
+   }
+   vector c(a);
+   SH_MATH_CHECK((c == a) == std :: equal(b.begin(), b.end(), b.begin()));
+   if (n != 0u)
+   {
+    const std :: size_t i = below(n);
+    c[i] = values[below(values.size())];
+    std :: vector<Type> d(b);
+    d[i] = c[i];
+    SH_MATH_CHECK((c == a) == (d == b));
+   }
+  }
+ }
+
+ //The string search starts at pos, so it also runs from unaligned addresses.
+ void compareStringFind(std :: size_t rounds)
+ {
+  for(std :: size_t round = 0u;round != rounds;++round)
+  {
+   std :: string b(below(201u), 'a');
+   for (char& c : b) c = static_cast<char>("ab\0\x80\xff"[below(5u)]);
+   const shMath :: fixedCapacityString<200> a(b);
+   const std :: size_t pos = below(b.size() + 2u);
+   const char c = static_cast<char>("ab\0\x80\xff"[below(5u)]);
+   SH_MATH_CHECK(a.find(c, pos) == b.find(c, pos));
+  }
+ }
+}
+
+int main()
+{
+ #ifdef __AVX2__
+ if (!__builtin_cpu_supports("avx2"))
+ {
+  return 77; //Skipped, see SKIP_RETURN_CODE.
+ }
+ #endif
+ compareSearches<std :: int8_t>(20000u);
+ compareSearches<std :: uint8_t>(20000u);
+ compareSearches<char>(20000u);
+ compareSearches<std :: int16_t>(20000u);
+ compareSearches<std :: int32_t>(20000u);
+ compareSearches<std :: int64_t>(20000u);
+ compareSearches<std :: uint64_t>(20000u);
+ compareSearches<float>(20000u);
+ compareSearches<double>(20000u);
+ compareStringFind(20000u);
+ return 0;
+}
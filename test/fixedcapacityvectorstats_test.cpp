@@ -0,0 +1,75 @@
+//Built with SH_MATH_FIXEDCAPACITYVECTOR_STATS defined.
+#include "fixedcapacitysoa.h"
+#include "fixedcapacityvector.h"
+#include "shmathtest.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <new>
+#include <string>
+#include <tuple>
+
+namespace
+{
+ //Everything fprintf wrote to a temporary file.
+ std :: string report()
+ {
+  std :: FILE* const out = std :: tmpfile();
+  SH_MATH_CHECK(out != nullptr);
+  shMath :: fixedCapacityVectorStatsReport(out);
+  std :: rewind(out);
+  std :: string result;
+  for(int c = std :: fgetc(out);c != EOF;c = std :: fgetc(out)) result.push_back(static_cast<char>(c));
+  std :: fclose(out);
+  return result;
+ }
+
+ //Peaks and overflows are shared by every vector of one <Type, Capacity>, and the report names the element type as written.
+ void checkCounters()
+ {
+  typedef shMath :: fixedCapacityVector<int, 8> vector;
+  shMath :: fixedCapacityVectorStatsRecord& record = shMath :: fixedCapacityVectorStats<int, 8>();
+  {
+   vector a(3u, 1);
+   vector b;
+   b.push_back(1);
+   SH_MATH_CHECK(record.Peak.load() == 3u);
+   a.resize(6u);
+   b.assign(5u, 2);
+   SH_MATH_CHECK((record.Peak.load() == 6u) && (record.Overflows.load() == 0u));
+   a.resize(8u);
+   SH_MATH_CHECK_THROWS(std :: bad_alloc, a.push_back(9));
+   SH_MATH_CHECK_THROWS(std :: bad_alloc, b.insert(b.begin(), 4u, 0));
+   SH_MATH_CHECK(a.try_push_back(9) == nullptr);
+   SH_MATH_CHECK((record.Peak.load() == 8u) && (record.Overflows.load() == 3u));
+   //0 to 3, 0 to 1, 3 to 6, 1 to 5 and 6 to 8 cross 1 and 2 twice each, 4 twice and 8 once.
+   SH_MATH_CHECK((record.Reached[0].load() == 2u) && (record.Reached[1].load() == 2u) && (record.Reached[2].load() == 2u) && (record.Reached[3].load() == 1u));
+  }
+  shMath :: fixedCapacityVector<double, 300> c(260u, 0.5);
+  SH_MATH_CHECK((shMath :: fixedCapacityVectorStats<double, 300>().Peak.load() == 260u) && (shMath :: fixedCapacityVectorStats<double, 300>().Reached[8].load() == 1u));
+  const std :: string text = report();
+  SH_MATH_CHECK(text.find("fixedCapacityVector<int, 8> (4 byte elements): peak 8, overflows 3, reached 1+:2 2+:2 4+:2 8+:1\n") != std :: string :: npos);
+  SH_MATH_CHECK(text.find("fixedCapacityVector<double, 300> (8 byte elements): peak 260, overflows 0,") != std :: string :: npos);
+ }
+
+ //fixedCapacitySoA reports under its row type.
+ void checkSoA()
+ {
+  typedef std :: tuple<int, float> row;
+  shMath :: fixedCapacitySoA<4, int, float> a;
+  for(int i = 0;i != 4;++i) a.emplace_back(i, 0.5f);
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, a.push_back(row(4, 1.5f)));
+  SH_MATH_CHECK_THROWS(std :: bad_alloc, a.emplace_back(5, 2.5f));
+  SH_MATH_CHECK(a.size() == 4u);
+  const shMath :: fixedCapacityVectorStatsRecord& record = shMath :: fixedCapacityVectorStats<row, 4>();
+  SH_MATH_CHECK((record.Peak.load() == 4u) && (record.Overflows.load() == 2u) && (record.Reached[2].load() == 1u));
+  SH_MATH_CHECK(report().find("<std::tuple<int, float>, 4> (8 byte elements): peak 4, overflows 2, reached 1+:1 2+:1 4+:1\n") != std :: string :: npos);
+ }
+}
+
+int main()
+{
+ checkCounters();
+ checkSoA();
+ return 0;
+}
@@ -0,0 +1,97 @@
+//Built with -fno-exceptions and SH_MATH_NO_EXCEPTIONS: every header has to compile without try and catch, and the try_ and unchecked_ calls report a full container instead of throwing.
+#include "concurrentfixedcapacityvector.h"
+#include "fixedcapacityflatmap.h"
+#include "fixedcapacityheap.h"
+#include "fixedcapacityring.h"
+#include "fixedcapacityslotmap.h"
+#include "fixedcapacitysoa.h"
+#include "fixedcapacitysort.h"
+#include "fixedcapacitystring.h"
+#include "fixedcapacityvector.h"
+#include "fixedcapacityvectorexpr.h"
+#include "smallvector.h"
+#include "shmathtest.h"
+
+#include <cstddef>
+#include <string>
+
+#ifndef SH_MATH_NO_EXCEPTIONS
+#error SH_MATH_NO_EXCEPTIONS should be defined for this test.
+#endif
+
+namespace
+{
+ using shMathTest :: value;
+
+ template <class Type> void checkVector()
+ {
+  shMath :: fixedCapacityVector<Type, 5> a;
+  for(std :: size_t i = 0u;i != 2u;++i)
+  {
+   const Type val = value<Type>();
+   SH_MATH_CHECK((a.try_push_back(val) == &a.back()) && (a.back() == val));
+  }
+  Type moved = value<Type>();
+  const Type copy = moved;
+  SH_MATH_CHECK(*a.try_push_back(static_cast<Type&&>(moved)) == copy);
+  SH_MATH_CHECK(*a.try_emplace_back(copy) == copy);
+  SH_MATH_CHECK(a.unchecked_emplace_back(copy) == copy);
+  SH_MATH_CHECK(a.size() == 5u);
+  const shMath :: fixedCapacityVector<Type, 5> full(a);
+  SH_MATH_CHECK((a.try_push_back(copy) == nullptr) && (a.try_emplace_back(copy) == nullptr) && (a == full));
+  a.pop_back();
+  SH_MATH_CHECK((a.unchecked_push_back(copy) == copy) && (a == full));
+ }
+
+ void checkBools()
+ {
+  shMath :: fixedCapacityVector<bool, 3> a;
+  SH_MATH_CHECK(a.try_push_back(true) && a.try_push_back(false));
+  a.unchecked_push_back(true);
+  SH_MATH_CHECK(!a.try_push_back(false) && (a.size() == 3u) && a[0] && !a[1] && a[2]);
+ }
+
+ void checkOthers()
+ {
+  shMath :: fixedCapacityString<6> s("abc");
+  SH_MATH_CHECK(!s.try_append("defgh", 5u) && (s == "abcdef"));
+
+  shMath :: fixedCapacityRing<int, 3> ring;
+  SH_MATH_CHECK(ring.try_push(1) && ring.try_emplace(2) && ring.try_push(3) && !ring.try_push(4));
+  const int values[] = {5, 6, 7};
+  int out[3] = {};
+  SH_MATH_CHECK(ring.try_push_n(values, 3u) == 0u);
+  SH_MATH_CHECK((ring.try_pop_n(out, 2u) == 2u) && (out[0] == 1) && (out[1] == 2));
+  SH_MATH_CHECK(ring.try_push_n(values, 3u) == 2u);
+  int last = 0;
+  SH_MATH_CHECK(ring.try_pop(last) && (last == 3) && (ring.size() == 2u));
+
+  shMath :: fixedCapacitySlotMap<std :: string, 2> slots;
+  const auto first = slots.try_emplace("first");
+  const auto second = slots.try_emplace(3u, 'x');
+  const auto third = slots.try_emplace("third");
+  SH_MATH_CHECK(slots.contains(first) && slots.contains(second) && !slots.contains(third) && (*slots.find(second) == "xxx"));
+
+  shMath :: concurrentFixedCapacityVector<int, 4> shared;
+  SH_MATH_CHECK(shared.try_push_back(1) && shared.try_emplace_back(2));
+  SH_MATH_CHECK((shared.try_append(values, 3u) == 2u) && !shared.try_push_back(8) && (shared.overflow_count() == 2u));
+  shared.seal();
+  SH_MATH_CHECK((shared.size() == 4u) && (shared.data()[3] == 6));
+
+  shMath :: fixedCapacityFlatMap<int, int, 4> map{{3, 1}, {1, 2}, {3, 4}};
+  SH_MATH_CHECK(map.try_emplace(2, 5).second && !map.try_emplace(1, 6).second && (map.size() == 3u) && (map.at(1) == 2));
+
+  shMath :: smallVector<std :: string, 2> small;
+  for(int i = 0;i != 5;++i) small.push_back(value<std :: string>());
+  SH_MATH_CHECK(small.size() == 5u);
+ }
+}
+
+int main()
+{
+ checkVector<int>();
+ checkVector<std :: string>();
+ checkBools();
+ checkOthers();
+ return 0;
+}
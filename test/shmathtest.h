@@ -0,0 +1,55 @@
+#ifndef SH_MATH_TEST
+#define SH_MATH_TEST
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+//Unlike assert, stays on in release builds.
+#define SH_MATH_CHECK(condition) ((condition) ? static_cast<void>(0) : shMathTest :: fail(#condition, __FILE__, __LINE__))
+#define SH_MATH_CHECK_THROWS(exception, statement) do { bool thrown = false; try { statement; } catch (const exception&) { thrown = true; } SH_MATH_CHECK(thrown); } while (false)
+
+namespace shMathTest
+{
+ [[noreturn]] inline void fail(const char* condition, const char* file, int line)
+ {
+  std :: fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+  std :: abort();
+ }
+
+ //Every test draws from the same fixed seed, so a failure replays.
+ inline std :: mt19937& random()
+ {
+  static std :: mt19937 generator(20240611u);
+  return generator;
+ }
+
+ inline std :: size_t below(std :: size_t n)
+ {
+  return (n == 0u) ? 0u : static_cast<std :: size_t>(random()() % n);
+ }
+
+ template <class Type> struct valueMaker;
+
+ template <> struct valueMaker<bool>
+ {
+  static bool make(std :: size_t i) { return (i % 2u) != 0u; }
+ };
+
+ template <> struct valueMaker<int>
+ {
+  static int make(std :: size_t i) { return static_cast<int>(i % 1000u); }
+ };
+
+ template <> struct valueMaker<std :: string>
+ {
+  static std :: string make(std :: size_t i) { return std :: string(24u + i % 8u, static_cast<char>('a' + i % 26u)); } //Longer than any small string buffer, so a leaked or twice destroyed element shows up under AddressSanitizer.
+ };
+
+ template <class Type> Type value()
+ {
+  return valueMaker<Type> :: make(below(1000u));
+ }
+}
+#endif
@@ -0,0 +1,231 @@
+#include "smallvector.h"
+#include "shmathtest.h"
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+ using shMathTest :: below;
+ using shMathTest :: value;
+
+ template <class Vector, class Reference> void checkSame(const Vector& a, const Reference& b)
+ {
+  SH_MATH_CHECK((a.size() == b.size()) && (a.empty() == b.empty()));
+  SH_MATH_CHECK(std :: equal(b.begin(), b.end(), a.begin()));
+  SH_MATH_CHECK(a.capacity() >= a.size());
+  SH_MATH_CHECK(a.is_inline() == (a.capacity() == Vector().capacity()));
+ }
+
+ //Three smallVector objects against three std :: vector objects, crossing the inline capacity in both directions.
+ template <class Type, std :: size_t InlineCapacity> void compareWithVector(std :: size_t steps)
+ {
+  typedef shMath :: smallVector<Type, InlineCapacity> vector;
+  vector a[3];
+  std :: vector<Type> b[3];
+  for(std :: size_t step = 0u;step != steps;++step)
+  {
+   const std :: size_t i = below(3u);
+   const std :: size_t j = below(3u);
+   vector& v = a[i];
+   std :: vector<Type>& r = b[i];
+   const Type val = value<Type>();
+   switch (below(13u))
+   {
+    case 0u:
+    case 1u:
+    v.push_back(val);
+    r.push_back(val);
+    break;
+    case 2u:
+    v.emplace_back(val);
+    r.emplace_back(val);
+    break;
+    case 3u:
+    if (!r.empty())
+    {
+     v.pop_back();
+     r.pop_back();
+    }
+    break;
+    case 4u:
+    v.swap(a[j]);
+    r.swap(b[j]);
+    break;
+    case 5u:
+    v = a[j];
+    r = b[j];
+    break;
+    case 6u:
+    if (i != j)
+    {
+     v = std :: move(a[j]);
+     r = std :: move(b[j]);
+     a[j].clear();
+     b[j].clear();
+    }
+    break;
+    case 7u:
+    {
+     const std :: size_t n = below(4u * InlineCapacity);
+     v.resize(n, val);
+     r.resize(n, val);
+    }
+    break;
+    case 8u:
+    {
+     const std :: size_t n = below(4u * InlineCapacity);
+     v.resize(n);
+     r.resize(n);
+    }
+    break;
+    case 9u:
+    if (!r.empty())
+    {
+     //The argument aliases an element which may move when the buffer grows.
+     v.push_back(v[0]);
+     r.push_back(r[0]);
+    }
+    break;
+    case 10u:
+    {
+     vector moved(std :: move(v));
+     std :: vector<Type> expected(std :: move(r));
+     r.clear();
+     checkSame(v, r);
+     checkSame(moved, expected);
+     v = moved;
+     r = expected;
+    }
+    break;
+    case 11u:
+    {
+     const vector copy(r.begin(), r.end());
+     checkSame(copy, r);
+     v.reserve(below(4u * InlineCapacity));
+    }
+    break;
+    case 12u:
+    if (below(8u) == 0u)
+    {
+     v.clear();
+     r.clear();
+    }
+    break;
+   }
+   for(std :: size_t k = 0u;k != 3u;++k) checkSame(a[k], b[k]);
+  }
+  SH_MATH_CHECK_THROWS(std :: out_of_range, a[0].at(a[0].size()));
+ }
+
+ int copiesLeft = -1;
+
+ //Copies throw once copiesLeft runs out, so constructors fail after part of their elements exist.
+ struct throwingCopy
+ {
+  std :: string Payload;
+  throwingCopy() : Payload(std :: string(32u, 'p')) {}
+  throwingCopy(const throwingCopy& a) : Payload(a.Payload)
+  {
+   if (copiesLeft-- == 0)
+   {
+    throw std :: runtime_error("copy");
+   }
+  }
+  throwingCopy& operator = (const throwingCopy&) = default;
+ };
+
+ //AddressSanitizer reports a leak if a constructor drops its spilled buffer.
+ void checkThrowingConstructors()
+ {
+  typedef shMath :: smallVector<throwingCopy, 4> vector;
+  const throwingCopy val;
+  const vector full(10u, val);
+  const std :: vector<throwingCopy> list(10u, val);
+  for(int n = 0;n != 10;++n)
+  {
+   copiesLeft = n;
+   SH_MATH_CHECK_THROWS(std :: runtime_error, vector a(10u, val));
+   copiesLeft = n;
+   SH_MATH_CHECK_THROWS(std :: runtime_error, vector a(full));
+   copiesLeft = n;
+   SH_MATH_CHECK_THROWS(std :: runtime_error, vector a(list.begin(), list.end()));
+   copiesLeft = n;
+   SH_MATH_CHECK_THROWS(std :: runtime_error, vector a({val, val, val, val, val, val, val, val, val, val}));
+  }
+  copiesLeft = -1;
+ }
+
+ int movesLeft = -1;
+
+ //Move only, and the move may throw, so relocation cannot fall back to copies and must not be noexcept either.
+ struct throwingMove
+ {
+  std :: unique_ptr<std :: string> Payload;
+  explicit throwingMove(const std :: string& val) : Payload(new std :: string(val)) {}
+  throwingMove(throwingMove&& a) : Payload(std :: move(a.Payload))
+  {
+   if (movesLeft-- == 0)
+   {
+    throw std :: runtime_error("move");
+   }
+  }
+  throwingMove& operator = (throwingMove&& a) = default;
+ };
+
+ //A move that throws while spilling or reserving reaches the caller, and AddressSanitizer catches a buffer left behind.
+ void checkThrowingMoves()
+ {
+  typedef shMath :: smallVector<throwingMove, 4> vector;
+  for(int n = 0;n != 12;++n)
+  {
+   vector a;
+   for(int i = 0;i != 4;++i) a.emplace_back(value<std :: string>());
+   movesLeft = n;
+   bool thrown = false;
+   try
+   {
+    throwingMove extra(value<std :: string>());
+    a.push_back(std :: move(extra));
+    a.reserve(64u);
+   }
+   catch (const std :: runtime_error&)
+   {
+    thrown = true;
+   }
+   movesLeft = -1;
+   SH_MATH_CHECK(thrown == (n < 10)); //One move for the new element and four to spill, then five more to reserve.
+   SH_MATH_CHECK((a.size() == 4u) || (a.size() == 5u));
+   a.emplace_back(value<std :: string>());
+  }
+ }
+
+ void checkSwap()
+ {
+  typedef shMath :: smallVector<std :: string, 2> vector;
+  static_assert(noexcept(std :: declval<vector&>().swap(std :: declval<vector&>())), "Swapping smallVector of nothrow movable elements should not throw.");
+  vector a = {"a", "b", "c"};
+  vector b = {"x"};
+  const std :: string* const spilled = a.data();
+  a.swap(b);
+  SH_MATH_CHECK((b.data() == spilled) && a.is_inline() && (a[0] == "x") && (b[2] == "c"));
+  vector c = {"q", "r", "s", "t"};
+  const std :: string* const other = c.data();
+  b.swap(c);
+  SH_MATH_CHECK((b.data() == other) && (c.data() == spilled));
+ }
+}
+
+int main()
+{
+ compareWithVector<int, 4>(100000u);
+ compareWithVector<std :: string, 3>(100000u);
+ checkThrowingConstructors();
+ checkThrowingMoves();
+ checkSwap();
+ return 0;
+}